@@ -0,0 +1,65 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+using namespace std;
+
+// Индексные циклы с проверкой границ (исключение) и без неё: скалярное
+// произведение и трёхточечный шаблон. Длина обработки n известна только во
+// время выполнения, как в реальных ядрах, поэтому компилятор не может
+// доказать, что проверка никогда не срабатывает.
+const size_t len = 4096;
+const size_t rounds = 100000;
+volatile size_t runtime_len = len;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; r++) {
+        f();
+        asm volatile("" ::: "memory");
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <class Bounds>
+[[gnu::noinline]] int dot(const my_container::Array<int, len, Bounds>& a, const my_container::Array<int, len, Bounds>& b, size_t n) {
+    int sum = 0;
+    for (size_t i = 0; i < n; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+template <class Bounds>
+[[gnu::noinline]] void stencil(const my_container::Array<float, len, Bounds>& in, my_container::Array<float, len, Bounds>& out, size_t n) {
+    for (size_t i = 1; i + 1 < n; i++)
+        out[i] = 0.25f * in[i - 1] + 0.5f * in[i] + 0.25f * in[i + 1];
+}
+
+template <class Bounds>
+void run(const char* name) {
+    static my_container::Array<int, len, Bounds> a, b;
+    static my_container::Array<float, len, Bounds> in, out;
+    for (size_t i = 0; i < len; i++) {
+        a[i] = int(i % 7);
+        b[i] = int(i % 5);
+        in[i] = float(i % 11);
+        out[i] = 0;
+    }
+    size_t n = runtime_len;
+    long long check = 0;
+    double dot_ms = measure([&] { check += dot(a, b, n); });
+    double stencil_ms = measure([&] {
+        stencil(in, out, n);
+        check += int(out[len / 2]);
+    });
+    printf("%-16s dot %8.2f ms  stencil %8.2f ms  check=%lld\n", name, dot_ms, stencil_ms, check);
+}
+
+int main() {
+    using namespace my_container;
+    printf("%zu elements, %zu rounds\n", len, rounds);
+    run<CheckedBounds>("CheckedBounds");
+    run<AssertBounds>("AssertBounds");
+    run<UncheckedBounds>("UncheckedBounds");
+    return 0;
+}
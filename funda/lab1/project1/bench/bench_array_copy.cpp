@@ -0,0 +1,87 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+using namespace std;
+
+// swap, копирование и перемещение Array против прежних реализаций:
+// обмена через временную копию элемента, конструктора копирования через
+// создание по умолчанию и присваивание и присваивания перемещением через
+// std::move по элементам.
+const size_t rounds = 2000;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; r++) {
+        f();
+        asm volatile("" ::: "memory");
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <class Arr>
+void old_swap(Arr& a, Arr& b) {
+    for (size_t i = 0; i < Arr::size(); i++) {
+        typename Arr::value_type tmp = a.data()[i];
+        a.data()[i] = b.data()[i];
+        b.data()[i] = tmp;
+    }
+}
+
+template <class Arr>
+void old_copy(Arr& dst, const Arr& src) {
+    ::new (&dst) Arr;
+    for (size_t i = 0; i < Arr::size(); i++)
+        dst.data()[i] = src.data()[i];
+}
+
+template <class Arr>
+void run(const char* name, const Arr& init) {
+    auto a = make_unique<Arr>(init), b = make_unique<Arr>(init);
+    // Сырая память под копии: каждую после замера уничтожаем вручную.
+    alignas(Arr) static unsigned char raw[sizeof(Arr)];
+    Arr* dst = reinterpret_cast<Arr*>(raw);
+
+    double swap_old = measure([&] { old_swap(*a, *b); });
+    double swap_new = measure([&] { a->swap(*b); });
+    double copy_old = measure([&] {
+        old_copy(*dst, *a);
+        asm volatile("" ::: "memory");
+        dst->~Arr();
+    });
+    double copy_new = measure([&] {
+        ::new (dst) Arr(*a);
+        asm volatile("" ::: "memory");
+        dst->~Arr();
+    });
+    double move_old = measure([&] {
+        std::move(a->begin(), a->end(), b->data());
+        std::move(b->begin(), b->end(), a->data());
+    });
+    double move_new = measure([&] {
+        *b = std::move(*a);
+        *a = std::move(*b);
+    });
+    printf("%-22s swap %8.2f /%8.2f   copy %8.2f /%8.2f   move %8.2f /%8.2f\n",
+        name, swap_old, swap_new, copy_old, copy_new, move_old, move_new);
+}
+
+int main() {
+    using namespace my_container;
+    printf("%zu rounds, ms: old / new\n", rounds);
+    {
+        Array<string, 256> init;
+        for (size_t i = 0; i < init.size(); i++)
+            init[i] = string(32, char('a' + i % 26));
+        run("Array<string, 256>", init);
+    }
+    {
+        Array<double, 4096> init;
+        for (size_t i = 0; i < init.size(); i++)
+            init[i] = double(i) * 0.5;
+        run("Array<double, 4096>", init);
+    }
+    return 0;
+}
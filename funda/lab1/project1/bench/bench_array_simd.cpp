@@ -0,0 +1,69 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+using namespace std;
+
+// Поэлементные операции и редукции Array против написанных вручную циклов по
+// data(), для float и N от 4 до 1024. Число повторов подобрано так, чтобы
+// каждый замер обрабатывал одинаковое число элементов.
+const size_t elements = 200000000;
+
+template <class F>
+double measure(size_t rounds, F f) {
+    auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; r++) {
+        f();
+        asm volatile("" ::: "memory");
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <size_t N>
+using Vec = my_container::Array<float, N, my_container::UncheckedBounds, 64>;
+
+template <size_t N>
+void run() {
+    using namespace my_container;
+    static Vec<N> a, b, c;
+    for (size_t i = 0; i < N; i++) {
+        a[i] = float(i % 13) * 0.5f;
+        b[i] = float(i % 7) - 3.0f;
+    }
+    const size_t rounds = elements / N;
+    float check = 0;
+
+    double add_loop = measure(rounds, [&] {
+        for (size_t i = 0; i < N; i++)
+            c.data()[i] = a.data()[i] + b.data()[i];
+    });
+    double add_array = measure(rounds, [&] { c = a + b; });
+
+    double dot_loop = measure(rounds, [&] {
+        float acc = 0;
+        for (size_t i = 0; i < N; i++)
+            acc += a.data()[i] * b.data()[i];
+        check += acc;
+    });
+    double dot_array = measure(rounds, [&] { check += dot(a, b); });
+
+    double max_loop = measure(rounds, [&] {
+        float m = a.data()[0];
+        for (size_t i = 1; i < N; i++)
+            m = a.data()[i] > m ? a.data()[i] : m;
+        check += m;
+    });
+    double max_array = measure(rounds, [&] { check += max(a); });
+
+    printf("%6zu  add %8.1f /%8.1f   dot %8.1f /%8.1f   max %8.1f /%8.1f   %g\n",
+        N, add_loop, add_array, dot_loop, dot_array, max_loop, max_array, double(check + c[0]));
+}
+
+int main() {
+    printf("float, %zu elements per measurement, ms: hand-written loop / Array\n", elements);
+    run<4>();
+    run<16>();
+    run<64>();
+    run<256>();
+    run<1024>();
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+using namespace std;
+using namespace my_container;
+
+// Транспонирование и умножение матриц N x N из double: вложенные
+// Array<Array<double, N>, N> против MdArray с построчной раскладкой,
+// по столбцам и плитками. Индексы везде без проверок.
+const size_t N = 512;
+const size_t B = 32;
+const size_t transpose_rounds = 100;
+const size_t matmul_rounds = 3;
+
+using Nested = Array<Array<double, N, UncheckedBounds>, N, UncheckedBounds>;
+using Rows = MdArray<double, N, N>;
+using Cols = BasicMdArray<double, ColumnMajor, N, N>;
+using Tiles = BasicMdArray<double, Tiled<B, B>, N, N>;
+
+template <class F>
+double measure(size_t rounds, F f) {
+    auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; r++) {
+        f();
+        asm volatile("" ::: "memory");
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <class M>
+void init(M& m, double shift) {
+    for (size_t i = 0; i < N; i++)
+        for (size_t j = 0; j < N; j++)
+            m(i, j) = double((i * 7 + j * 3) % 17) + shift;
+}
+
+void init(Nested& m, double shift) {
+    for (size_t i = 0; i < N; i++)
+        for (size_t j = 0; j < N; j++)
+            m[i][j] = double((i * 7 + j * 3) % 17) + shift;
+}
+
+// Перемножение блоками B x B в порядке i-k-j: рабочий набор из трёх
+// блоков помещается в кэш. Строка блока непрерывна и при построчной
+// раскладке, и в плитке B x B, поэтому внутренний цикл идёт по указателям
+// и векторизуется.
+template <class MA, class MB, class MC>
+void blocked_matmul(const MA& a, const MB& b, MC& c) {
+    c.fill(0);
+    for (size_t ii = 0; ii < N; ii += B)
+        for (size_t kk = 0; kk < N; kk += B)
+            for (size_t jj = 0; jj < N; jj += B)
+                for (size_t i = ii; i < ii + B; i++) {
+                    double* crow = &c(i, jj);
+                    for (size_t k = kk; k < kk + B; k++) {
+                        double aik = a(i, k);
+                        const double* brow = &b(k, jj);
+                        for (size_t j = 0; j < B; j++)
+                            crow[j] += aik * brow[j];
+                    }
+                }
+}
+
+int main() {
+    printf("N=%zu, block %zu, ms: %zu transposes, %zu products\n", N, B, transpose_rounds, matmul_rounds);
+
+    auto na = make_unique<Nested>(), nb = make_unique<Nested>(), nc = make_unique<Nested>();
+    auto ra = make_unique<Rows>(), rb = make_unique<Rows>(), rc = make_unique<Rows>();
+    auto cb = make_unique<Cols>();
+    auto ta = make_unique<Tiles>(), tb = make_unique<Tiles>(), tc = make_unique<Tiles>();
+    init(*na, 0);
+    init(*nb, 1);
+    init(*ra, 0);
+    init(*rb, 1);
+    init(*cb, 1);
+    init(*ta, 0);
+    init(*tb, 1);
+
+    double t_nested = measure(transpose_rounds, [&] {
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < N; j++)
+                (*nc)[j][i] = (*na)[i][j];
+    });
+    double t_blocked = measure(transpose_rounds, [&] {
+        ra->for_each_block<B, B>([&](auto blk, size_t i0, size_t j0) {
+            auto dst = rc->sub({ j0, i0 }, { B, B });
+            for (size_t i = 0; i < B; i++)
+                for (size_t j = 0; j < B; j++)
+                    dst(j, i) = blk(i, j);
+        });
+    });
+    double t_tiled = measure(transpose_rounds, [&] {
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < N; j++)
+                (*tc)(j, i) = (*ta)(i, j);
+    });
+    printf("transpose  nested %8.2f   row-major blocks %8.2f   tiled %8.2f\n", t_nested, t_blocked, t_tiled);
+
+    double m_nested = measure(matmul_rounds, [&] {
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < N; j++) {
+                double acc = 0;
+                for (size_t k = 0; k < N; k++)
+                    acc += (*na)[i][k] * (*nb)[k][j];
+                (*nc)[i][j] = acc;
+            }
+    });
+    double m_cols = measure(matmul_rounds, [&] {
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < N; j++) {
+                double acc = 0;
+                for (size_t k = 0; k < N; k++)
+                    acc += (*ra)(i, k) * (*cb)(k, j);
+                (*rc)(i, j) = acc;
+            }
+    });
+    double m_rows = measure(matmul_rounds, [&] { blocked_matmul(*ra, *rb, *rc); });
+    double m_tiled = measure(matmul_rounds, [&] { blocked_matmul(*ta, *tb, *tc); });
+    printf("matmul     nested %8.2f   A rows * B cols %8.2f   row-major blocks %8.2f   tiled %8.2f\n",
+        m_nested, m_cols, m_rows, m_tiled);
+
+    printf("check %g %g %g %g\n", (*nc)[5][7], (*rc)(5, 7), (*tc)(5, 7), (*rc)(7, 5));
+    return 0;
+}
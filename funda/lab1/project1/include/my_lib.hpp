@@ -1,9 +1,17 @@
 #ifndef BORDER
 #define BORDER
+#include <algorithm>
+#include <cassert>
 #include <iterator>
 #include <iostream>
 #include <initializer_list>
 #include <compare>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 using namespace std;
 
 template <class T>
@@ -37,50 +45,96 @@ Container<T>::~Container() = default;
 
 namespace my_container {
 
-    template <class T, size_t N>
-    class Array : public Container<T> {
+    // Политики проверки индекса для Array: исключение out_of_range, assert
+    // только в отладочной сборке или без проверки вовсе. Без проверки циклы
+    // по индексу векторизуются компилятором.
+    struct CheckedBounds {
+        static constexpr void check(size_t i, size_t n) {
+            if (i >= n) throw out_of_range("Index out of range");
+        }
+    };
+    struct AssertBounds {
+        static constexpr void check([[maybe_unused]] size_t i, [[maybe_unused]] size_t n) noexcept { assert(i < n); }
+    };
+    struct UncheckedBounds {
+        static constexpr void check(size_t, size_t) noexcept {}
+    };
+
+    // Array не наследует Container: без виртуальных функций он остаётся
+    // литеральным типом, так что таблицы из Array можно строить на этапе
+    // компиляции и класть в constexpr-переменные, а в объекте нет указателя
+    // на vtable. Align задаёт выравнивание хранилища, например 32 или 64
+    // байта под векторные регистры.
+    template <class T, size_t N, class Bounds = CheckedBounds, size_t Align = alignof(T)>
+    class Array {
+        static_assert(Align >= alignof(T) && (Align & (Align - 1)) == 0, "Align must be a power of two not less than alignof(T)");
+
     private:
-        T data_[N];
+        alignas(Align) T data_[N];
 
     public:
+        // Непрерывный итератор произвольного доступа: подходит для алгоритмов
+        // стандартной библиотеки, в том числе с политиками выполнения.
         template <class IterType>
         class Iterator final {
 
         protected:
             friend class Array;
+            template <class>
+            friend class Iterator;
             IterType* ptr = nullptr;
-            Iterator(IterType* ptr) : ptr(ptr) {}
+            constexpr Iterator(IterType* ptr) : ptr(ptr) {}
 
         public:
-            Iterator(const Iterator& other) = default;
-            //Iterator(Iterator&& other) = default;
-            Iterator& operator++() {
+            using iterator_category = random_access_iterator_tag;
+            using iterator_concept = contiguous_iterator_tag;
+            using value_type = remove_cv_t<IterType>;
+            using difference_type = ptrdiff_t;
+            using pointer = IterType*;
+            using reference = IterType&;
+
+            constexpr Iterator() = default;
+            constexpr Iterator(const Iterator& other) = default;
+            constexpr Iterator& operator=(const Iterator& other) = default;
+            // iterator неявно приводится к const_iterator.
+            template <class Other>
+                requires (is_const_v<IterType> && is_same_v<Other, remove_const_t<IterType>>)
+            constexpr Iterator(const Iterator<Other>& other) : ptr(other.ptr) {}
+            constexpr Iterator& operator++() {
                 this->ptr++;
                 return *this;
             }
-            Iterator operator++(int) {
+            constexpr Iterator operator++(int) {
                 Iterator tmp = *this;
                 ++this->ptr;
                 return tmp;
             }
-            Iterator& operator--() {
+            constexpr Iterator& operator--() {
                 this->ptr--;
                 return *this;
             }
-            Iterator operator--(int) {
+            constexpr Iterator operator--(int) {
                 Iterator tmp = *this;
                 --this->ptr;
                 return tmp;
             }
-            Iterator operator+(int n) { return Iterator(this->ptr + n); }
-            Iterator operator-(int n) { return Iterator(this->ptr - n); }
-            bool operator==(const Iterator& other) const { return this->ptr == other.ptr; }
-            bool operator!=(const Iterator& other) const { return this->ptr != other.ptr; }
-            bool operator>(const Iterator& other) const { return this->ptr > other.ptr; }
-            bool operator>=(const Iterator& other) const { return this->ptr >= other.ptr; }
-            bool operator<(const Iterator& other) const { return this->ptr < other.ptr; }
-            bool operator<=(const Iterator& other) const { return this->ptr <= other.ptr; }
-            IterType& operator*() { return *this->ptr; }
+            constexpr Iterator& operator+=(difference_type n) {
+                this->ptr += n;
+                return *this;
+            }
+            constexpr Iterator& operator-=(difference_type n) {
+                this->ptr -= n;
+                return *this;
+            }
+            constexpr Iterator operator+(difference_type n) const { return Iterator(this->ptr + n); }
+            friend constexpr Iterator operator+(difference_type n, const Iterator& i) { return Iterator(i.ptr + n); }
+            constexpr Iterator operator-(difference_type n) const { return Iterator(this->ptr - n); }
+            constexpr difference_type operator-(const Iterator& other) const { return this->ptr - other.ptr; }
+            constexpr bool operator==(const Iterator& other) const { return this->ptr == other.ptr; }
+            constexpr strong_ordering operator<=>(const Iterator& other) const { return this->ptr <=> other.ptr; }
+            constexpr reference operator*() const { return *this->ptr; }
+            constexpr pointer operator->() const { return this->ptr; }
+            constexpr reference operator[](difference_type n) const { return this->ptr[n]; }
         };
 
         template <class IterType>
@@ -89,69 +143,75 @@ namespace my_container {
         protected:
             friend class Array;
             IterType* ptr = nullptr;
-            RIterator(IterType* ptr) : ptr(ptr) {}
+            constexpr RIterator(IterType* ptr) : ptr(ptr) {}
 
         public:
-            RIterator(const RIterator& other) = default;
+            constexpr RIterator(const RIterator& other) = default;
             //RIterator(RIterator&& other) = default;
-            RIterator& operator++() {
+            constexpr RIterator& operator++() {
                 this->ptr--;
                 return *this;
             }
-            RIterator operator++(int) {
+            constexpr RIterator operator++(int) {
                 RIterator tmp = *this;
                 --this->ptr;
                 return tmp;
             }
-            RIterator& operator--() {
+            constexpr RIterator& operator--() {
                 this->ptr++;
                 return *this;
             }
-            RIterator operator--(int) {
+            constexpr RIterator operator--(int) {
                 RIterator tmp = *this;
                 ++this->ptr;
                 return tmp;
             }
-            RIterator operator+(int n) { return RIterator(this->ptr - n); }
-            RIterator operator-(int n) { return RIterator(this->ptr + n); }
-            bool operator==(const RIterator& other) const { return this->ptr == other.ptr; }
-            bool operator!=(const RIterator& other) const { return this->ptr != other.ptr; }
-            bool operator>(const RIterator& other) const { return this->ptr > other.ptr; }
-            bool operator>=(const RIterator& other) const { return this->ptr >= other.ptr; }
-            bool operator<(const RIterator& other) const { return this->ptr < other.ptr; }
-            bool operator<=(const RIterator& other) const { return this->ptr <= other.ptr; }
-            IterType& operator*() { return *this->ptr; }
+            constexpr RIterator operator+(int n) { return RIterator(this->ptr - n); }
+            constexpr RIterator operator-(int n) { return RIterator(this->ptr + n); }
+            constexpr bool operator==(const RIterator& other) const { return this->ptr == other.ptr; }
+            constexpr bool operator!=(const RIterator& other) const { return this->ptr != other.ptr; }
+            constexpr bool operator>(const RIterator& other) const { return this->ptr > other.ptr; }
+            constexpr bool operator>=(const RIterator& other) const { return this->ptr >= other.ptr; }
+            constexpr bool operator<(const RIterator& other) const { return this->ptr < other.ptr; }
+            constexpr bool operator<=(const RIterator& other) const { return this->ptr <= other.ptr; }
+            constexpr IterType& operator*() { return *this->ptr; }
         };
 
         using iterator = Iterator<T>;
         using const_iterator = Iterator<const T>;
         using reverse_iterator = RIterator<T>;
         using const_reverse_iterator = RIterator<const T>;
-        using typename Container<T>::value_type;
-        using typename Container<T>::size_type;
-        using typename Container<T>::reference;
-        using typename Container<T>::const_reference;
-        using typename Container<T>::pointer;
-        using typename Container<T>::const_pointer;
-
-        ~Array() = default;
-        Array() = default;
-        size_type size() const noexcept override final { return N; }
-        size_type max_size() const noexcept override final { return N; }
-        bool empty() const noexcept override final { return N == 0; }
-        reference operator[](size_type i) {
-            if (i >= N) throw out_of_range("Index out of range");
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = T*;
+        using const_pointer = const T*;
+
+        constexpr ~Array() = default;
+        constexpr Array() = default;
+        static constexpr size_type size() noexcept { return N; }
+        static constexpr size_type max_size() noexcept { return N; }
+        static constexpr bool empty() noexcept { return N == 0; }
+        // Индекс проверяется политикой Bounds. С CheckedBounds выход за
+        // границы в константном выражении — ошибка компиляции.
+        constexpr reference operator[](size_type i) noexcept(noexcept(Bounds::check(i, N))) {
+            Bounds::check(i, N);
             return data_[i];
         }
-        const_reference operator[](size_type i) const {
-            if (i >= N) throw out_of_range("Index out of range");
+        constexpr const_reference operator[](size_type i) const noexcept(noexcept(Bounds::check(i, N))) {
+            Bounds::check(i, N);
             return data_[i];
         }
-        reference front() { return data_[0]; }
-        const_reference front() const { return data_[0]; }
-        reference back() { return data_[N - 1]; }
-        const_reference back() const { return data_[N - 1]; }
-        reference at(size_type i) {
+        constexpr reference front() noexcept(noexcept(Bounds::check(0, N))) { return (*this)[0]; }
+        constexpr const_reference front() const noexcept(noexcept(Bounds::check(0, N))) { return (*this)[0]; }
+        constexpr reference back() noexcept(noexcept(Bounds::check(0, N))) { return (*this)[N - 1]; }
+        constexpr const_reference back() const noexcept(noexcept(Bounds::check(0, N))) { return (*this)[N - 1]; }
+        constexpr reference at(size_type i) noexcept(noexcept(Bounds::check(i, N))) {
+            return (*this)[i];
+        }
+        constexpr const_reference at(size_type i) const noexcept(noexcept(Bounds::check(i, N))) {
             return (*this)[i];
         }
         /*void print() const {
@@ -159,72 +219,447 @@ namespace my_container {
                 cout << data_[i] << ' ';
             cout << '\n';
         }*/
-        Array(initializer_list<T> init) {
+        // Недостающие элементы инициализируются значением по умолчанию, как у
+        // std::array.
+        constexpr Array(initializer_list<T> init) {
             if (init.size() > N)
                 throw out_of_range("Too many elements for Array");
             size_type i = 0;
             for (auto elem : init)
                 data_[i++] = elem;
+            for (; i < N; i++)
+                data_[i] = T{};
         }
-        Array(const Array& a) {
-            for (size_type i = 0; i < N; i++)
-                data_[i] = a[i];
-        }
-        Array(Array&& a) noexcept { move(a.begin(), a.end(), data_); }
-        Array& operator=(const Container<T>& other) {
-            const Array& a = dynamic_cast<const Array&>(other);
-            if (this != &other) {
-                for (size_type i = 0; i < N; i++)
-                    data_[i] = a[i];
-            }
-            return *this;
-        }
-        pointer data() noexcept { return data_; }
-        void fill(const_reference val) {
+        // Копирование и перемещение поэлементные, их генерирует компилятор:
+        // элементы сразу копируются или перемещаются конструктором, а не
+        // создаются по умолчанию и затем присваиваются, а для тривиально
+        // копируемых T всё сводится к memcpy.
+        constexpr Array(const Array& a) = default;
+        constexpr Array(Array&& a) = default;
+        constexpr Array& operator=(const Array& a) = default;
+        constexpr Array& operator=(Array&& a) = default;
+        constexpr pointer data() noexcept { return data_; }
+        constexpr const_pointer data() const noexcept { return data_; }
+        constexpr void fill(const_reference val) {
             for (size_type i = 0; i < N; i++)
                 data_[i] = val;
         }
-        void swap(Array& a) noexcept {
-            for (size_type i = 0; i < N; i++) {
-                value_type tmp = data_[i];
-                data_[i] = a[i];
-                a[i] = tmp;
+        // Тривиально копируемые элементы меняются блоками через буфер на
+        // стеке, остальные — поэлементным swap, который для string и
+        // подобных типов лишь обменивает указатели без выделения памяти.
+        constexpr void swap(Array& a) noexcept(is_nothrow_swappable_v<T>) {
+            if constexpr (is_trivially_copyable_v<T>) {
+                if (!is_constant_evaluated()) {
+                    if (this == &a)
+                        return;
+                    constexpr size_type block = sizeof(T) < 256 ? 256 / sizeof(T) : 1;
+                    unsigned char buf[block * sizeof(T)];
+                    auto swap_block = [&](size_type i, size_type bytes) {
+                        memcpy(buf, data_ + i, bytes);
+                        memcpy(data_ + i, a.data_ + i, bytes);
+                        memcpy(a.data_ + i, buf, bytes);
+                    };
+                    // Полные блоки копируются с постоянным размером, такой
+                    // memcpy компилятор разворачивает в векторные пересылки.
+                    size_type i = 0;
+                    for (; i + block <= N; i += block)
+                        swap_block(i, sizeof(buf));
+                    if (i < N)
+                        swap_block(i, (N - i) * sizeof(T));
+                    return;
+                }
             }
+            using std::swap;
+            for (size_type i = 0; i < N; i++)
+                swap(data_[i], a.data_[i]);
         }
 
-        auto operator<=>(const Array& other) const {
+        constexpr compare_three_way_result_t<T> operator<=>(const Array& other) const {
             for (size_type i = 0; i < N; ++i) {
                 if (auto cmp = data_[i] <=> other.data_[i]; cmp != 0)
                     return cmp;
             }
             return strong_ordering::equal;
         }
-        bool operator==(const Container<T>& other) const override final {
-            const Array& a = dynamic_cast<const Array&>(other);
-            if (N != a.size())
-                return false;
-            return (*this <=> a) == 0;
-        }
-        bool operator!=(const Container<T>& other) const override final {
-            const Array& a = dynamic_cast<const Array&>(other);
-            if (N != a.size())
-                return false;
-            return (*this <=> a) != 0;
-        }
-        bool operator<(const Array& other) const { return (*this <=> other) < 0; }
-        bool operator<=(const Array& other) const { return (*this <=> other) <= 0; }
-        bool operator>(const Array& other) const { return (*this <=> other) > 0; }
-        bool operator>=(const Array& other) const { return (*this <=> other) >= 0; }
-
-        iterator begin() noexcept { return iterator(data_); }
-        iterator end() noexcept { return iterator(data_ + N); }
-        const_iterator cbegin() const noexcept { return const_iterator(data_); }
-        const_iterator cend() const noexcept { return const_iterator(data_ + N); }
-        reverse_iterator rbegin() noexcept { return reverse_iterator(data_ + N - 1); }
-        reverse_iterator rend() noexcept { return reverse_iterator(data_ - 1); }
-        const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(data_ + N - 1); }
-        const_reverse_iterator crend() const noexcept { return const_reverse_iterator(data_ - 1); }
+        constexpr bool operator==(const Array& other) const { return (*this <=> other) == 0; }
+        constexpr bool operator<(const Array& other) const { return (*this <=> other) < 0; }
+        constexpr bool operator<=(const Array& other) const { return (*this <=> other) <= 0; }
+        constexpr bool operator>(const Array& other) const { return (*this <=> other) > 0; }
+        constexpr bool operator>=(const Array& other) const { return (*this <=> other) >= 0; }
+
+        constexpr iterator begin() noexcept { return iterator(data_); }
+        constexpr iterator end() noexcept { return iterator(data_ + N); }
+        constexpr const_iterator begin() const noexcept { return const_iterator(data_); }
+        constexpr const_iterator end() const noexcept { return const_iterator(data_ + N); }
+        constexpr const_iterator cbegin() const noexcept { return const_iterator(data_); }
+        constexpr const_iterator cend() const noexcept { return const_iterator(data_ + N); }
+        constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(data_ + N - 1); }
+        constexpr reverse_iterator rend() noexcept { return reverse_iterator(data_ - 1); }
+        constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(data_ + N - 1); }
+        constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator(data_ - 1); }
+
+    };
+
+    template <class T, size_t N, class B, size_t A>
+    constexpr void swap(Array<T, N, B, A>& a, Array<T, N, B, A>& b) noexcept(noexcept(a.swap(b))) { a.swap(b); }
+
+    // Алгоритмы над Array, пригодные и для вычислений на этапе компиляции.
+    template <class T, size_t N, class B, size_t A, class Compare = less<>>
+    constexpr void sort(Array<T, N, B, A>& a, Compare comp = Compare{}) {
+        std::sort(a.begin(), a.end(), comp);
+    }
+    template <class T, size_t N, class B, size_t A>
+    constexpr typename Array<T, N, B, A>::const_iterator find(const Array<T, N, B, A>& a, const T& value) {
+        return std::find(a.begin(), a.end(), value);
+    }
+    template <class T, size_t N, class B, size_t A>
+    constexpr typename Array<T, N, B, A>::iterator find(Array<T, N, B, A>& a, const T& value) {
+        return std::find(a.begin(), a.end(), value);
+    }
+    template <class T, size_t N, class B, size_t A, class U, class BinaryOp = plus<>>
+    constexpr U accumulate(const Array<T, N, B, A>& a, U init, BinaryOp op = BinaryOp{}) {
+        return std::accumulate(a.begin(), a.end(), std::move(init), op);
+    }
+
+    namespace detail {
+        // Число независимых аккумуляторов в редукциях — столько элементов
+        // помещается в 64 байта. Для float компилятор не может сам
+        // переставлять сложения, а так каждая полоса копит свою частичную
+        // сумму и цикл собирается в векторные инструкции.
+        template <class T>
+        inline constexpr size_t reduce_lanes = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+
+        template <size_t N, class Load, class Op>
+        constexpr auto reduce(Load load, Op op) {
+            using T = decltype(load(size_t(0)));
+            constexpr size_t L = reduce_lanes<T>;
+            if constexpr (N < 2 * L) {
+                // Короткие массивы разворачиваются полностью на этапе компиляции
+                return [&]<size_t... I>(index_sequence<I...>) {
+                    T acc = load(0);
+                    ((acc = op(acc, load(I + 1))), ...);
+                    return acc;
+                }(make_index_sequence<N - 1>());
+            }
+            else {
+                T lanes[L];
+                for (size_t j = 0; j < L; j++)
+                    lanes[j] = load(j);
+                constexpr size_t body = N - N % L;
+                for (size_t i = L; i < body; i += L)
+                    for (size_t j = 0; j < L; j++)
+                        lanes[j] = op(lanes[j], load(i + j));
+                for (size_t j = 0; j < N % L; j++)
+                    lanes[j] = op(lanes[j], load(body + j));
+                for (size_t width = L / 2; width > 0; width /= 2)
+                    for (size_t j = 0; j < width; j++)
+                        lanes[j] = op(lanes[j], lanes[j + width]);
+                return lanes[0];
+            }
+        }
+
+        template <class T, size_t N, class B, size_t A, class Op>
+        constexpr Array<T, N, B, A> zip(const Array<T, N, B, A>& a, const Array<T, N, B, A>& b, Op op) {
+            Array<T, N, B, A> result;
+            for (size_t i = 0; i < N; i++)
+                result.data()[i] = op(a.data()[i], b.data()[i]);
+            return result;
+        }
+        template <class T, size_t N, class B, size_t A, class Op>
+        constexpr Array<T, N, B, A>& zip_assign(Array<T, N, B, A>& a, const Array<T, N, B, A>& b, Op op) {
+            for (size_t i = 0; i < N; i++)
+                a.data()[i] = op(a.data()[i], b.data()[i]);
+            return a;
+        }
+        template <class T, size_t N, class B, size_t A, class Op>
+        constexpr Array<T, N, B, A> map(const Array<T, N, B, A>& a, Op op) {
+            Array<T, N, B, A> result;
+            for (size_t i = 0; i < N; i++)
+                result.data()[i] = op(a.data()[i]);
+            return result;
+        }
+    }
+
+    // Поэлементная арифметика. Циклы идут напрямую по хранилищу без проверок
+    // индекса и с известной на этапе компиляции длиной, поэтому для
+    // арифметических T компилятор превращает их в векторные инструкции.
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> operator+(const Array<T, N, B, A>& a, const Array<T, N, B, A>& b) { return detail::zip(a, b, plus<>()); }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> operator-(const Array<T, N, B, A>& a, const Array<T, N, B, A>& b) { return detail::zip(a, b, minus<>()); }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> operator*(const Array<T, N, B, A>& a, const Array<T, N, B, A>& b) { return detail::zip(a, b, multiplies<>()); }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> operator/(const Array<T, N, B, A>& a, const Array<T, N, B, A>& b) { return detail::zip(a, b, divides<>()); }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A>& operator+=(Array<T, N, B, A>& a, const Array<T, N, B, A>& b) { return detail::zip_assign(a, b, plus<>()); }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A>& operator-=(Array<T, N, B, A>& a, const Array<T, N, B, A>& b) { return detail::zip_assign(a, b, minus<>()); }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A>& operator*=(Array<T, N, B, A>& a, const Array<T, N, B, A>& b) { return detail::zip_assign(a, b, multiplies<>()); }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A>& operator/=(Array<T, N, B, A>& a, const Array<T, N, B, A>& b) { return detail::zip_assign(a, b, divides<>()); }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> operator*(const Array<T, N, B, A>& a, const type_identity_t<T>& s) {
+        return detail::map(a, [&s](const T& x) { return x * s; });
+    }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> operator*(const type_identity_t<T>& s, const Array<T, N, B, A>& a) {
+        return detail::map(a, [&s](const T& x) { return s * x; });
+    }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> operator/(const Array<T, N, B, A>& a, const type_identity_t<T>& s) {
+        return detail::map(a, [&s](const T& x) { return x / s; });
+    }
+
+    // Поэлементные минимум и максимум
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> min(const Array<T, N, B, A>& a, const Array<T, N, B, A>& b) {
+        return detail::zip(a, b, [](const T& x, const T& y) { return y < x ? y : x; });
+    }
+    template <class T, size_t N, class B, size_t A>
+    constexpr Array<T, N, B, A> max(const Array<T, N, B, A>& a, const Array<T, N, B, A>& b) {
+        return detail::zip(a, b, [](const T& x, const T& y) { return x < y ? y : x; });
+    }
+
+    // Редукции. Для чисел с плавающей точкой порядок сложения отличается от
+    // последовательного, поэтому результат может расходиться с ним в
+    // последних битах.
+    template <class T, size_t N, class B, size_t A>
+    constexpr T sum(const Array<T, N, B, A>& a) {
+        return detail::reduce<N>([&a](size_t i) { return a.data()[i]; }, plus<>());
+    }
+    template <class T, size_t N, class B, size_t A>
+    constexpr T dot(const Array<T, N, B, A>& a, const Array<T, N, B, A>& b) {
+        return detail::reduce<N>([&a, &b](size_t i) { return a.data()[i] * b.data()[i]; }, plus<>());
+    }
+    template <class T, size_t N, class B, size_t A>
+    constexpr T min(const Array<T, N, B, A>& a) {
+        static_assert(N > 0, "min of an empty Array");
+        return detail::reduce<N>([&a](size_t i) { return a.data()[i]; }, [](const T& x, const T& y) { return y < x ? y : x; });
+    }
+    template <class T, size_t N, class B, size_t A>
+    constexpr T max(const Array<T, N, B, A>& a) {
+        static_assert(N > 0, "max of an empty Array");
+        return detail::reduce<N>([&a](size_t i) { return a.data()[i]; }, [](const T& x, const T& y) { return x < y ? y : x; });
+    }
+
+    // Раскладки многомерного массива в памяти. offset переводит набор
+    // индексов в смещение в хранилище, required_size — сколько элементов
+    // хранилища нужно для массива с экстентами E.
+    struct RowMajor {
+        template <size_t... E>
+        static constexpr size_t required_size = (E * ...);
+
+        template <size_t... E>
+        static constexpr size_t offset(const Array<size_t, sizeof...(E), UncheckedBounds>& idx) noexcept {
+            constexpr size_t ext[] = { E... };
+            size_t off = 0;
+            for (size_t k = 0; k < sizeof...(E); k++)
+                off = off * ext[k] + idx[k];
+            return off;
+        }
+    };
+    struct ColumnMajor {
+        template <size_t... E>
+        static constexpr size_t required_size = (E * ...);
+
+        template <size_t... E>
+        static constexpr size_t offset(const Array<size_t, sizeof...(E), UncheckedBounds>& idx) noexcept {
+            constexpr size_t ext[] = { E... };
+            size_t off = 0;
+            for (size_t k = sizeof...(E); k-- > 0;)
+                off = off * ext[k] + idx[k];
+            return off;
+        }
+    };
+    // Матрица разбита на плитки TR x TC, плитки лежат построчно, внутри
+    // плитки элементы тоже построчно. Соседние и по строке, и по столбцу
+    // элементы оказываются рядом, что хорошо для блочных алгоритмов.
+    // Хранилище дополняется до целого числа плиток.
+    template <size_t TR, size_t TC>
+    struct Tiled {
+        static_assert(TR > 0 && TC > 0, "Tile must not be empty");
+
+        template <size_t R, size_t C>
+        static constexpr size_t required_size = (R + TR - 1) / TR * TR * ((C + TC - 1) / TC * TC);
 
+        template <size_t R, size_t C>
+        static constexpr size_t offset(const Array<size_t, 2, UncheckedBounds>& idx) noexcept {
+            constexpr size_t tiles_in_row = (C + TC - 1) / TC;
+            size_t i = idx[0], j = idx[1];
+            return ((i / TR) * tiles_in_row + j / TC) * (TR * TC) + (i % TR) * TC + j % TC;
+        }
     };
+
+    // Невладеющее окно в многомерный массив с раскладкой Layout и
+    // экстентами E: подматрица или срез меньшей размерности. Хранит начало
+    // окна в индексах исходного массива и то, какому измерению исходного
+    // массива соответствует каждое измерение окна, поэтому работает с любой
+    // раскладкой и ничего не копирует. T может быть const.
+    template <class T, class Layout, size_t V, size_t... E>
+    class MdView {
+        static constexpr size_t R = sizeof...(E);
+        static_assert(V > 0 && V <= R, "Bad view rank");
+
+    public:
+        using value_type = remove_cv_t<T>;
+        using reference = T&;
+        using index_type = Array<size_t, R, UncheckedBounds>;
+        using extents_type = Array<size_t, V, UncheckedBounds>;
+
+    private:
+        T* data_;
+        index_type origin_;
+        extents_type extents_;
+        extents_type dims_;
+
+        template <class, class, size_t, size_t...>
+        friend class MdView;
+        template <class, class, size_t...>
+        friend class BasicMdArray;
+
+        constexpr MdView(T* data, const index_type& origin, const extents_type& extents, const extents_type& dims) noexcept
+            : data_(data), origin_(origin), extents_(extents), dims_(dims) {}
+
+    public:
+        static constexpr size_t rank() noexcept { return V; }
+        constexpr size_t extent(size_t k) const noexcept { return extents_[k]; }
+        constexpr size_t size() const noexcept {
+            size_t n = 1;
+            for (size_t k = 0; k < V; k++)
+                n *= extents_[k];
+            return n;
+        }
+
+        template <class... Idx>
+            requires (sizeof...(Idx) == V)
+        constexpr reference operator()(Idx... i) const noexcept {
+            index_type idx = origin_;
+            size_t k = 0;
+            ((assert(size_t(i) < extents_[k]), idx[dims_[k]] += size_t(i), k++), ...);
+            return data_[Layout::template offset<E...>(idx)];
+        }
+
+        // Подокно с началом first и размерами extents в индексах этого окна
+        constexpr MdView sub(const extents_type& first, const extents_type& extents) const noexcept {
+            index_type origin = origin_;
+            for (size_t k = 0; k < V; k++) {
+                assert(first[k] + extents[k] <= extents_[k]);
+                origin[dims_[k]] += first[k];
+            }
+            return MdView(data_, origin, extents, dims_);
+        }
+        // Срез: измерение D фиксируется значением i, размерность падает на 1
+        template <size_t D>
+        constexpr MdView<T, Layout, V - 1, E...> slice(size_t i) const noexcept {
+            static_assert(D < V && V > 1, "Bad slice dimension");
+            assert(i < extents_[D]);
+            index_type origin = origin_;
+            origin[dims_[D]] += i;
+            Array<size_t, V - 1, UncheckedBounds> extents, dims;
+            for (size_t k = 0, m = 0; k < V; k++) {
+                if (k == D)
+                    continue;
+                extents[m] = extents_[k];
+                dims[m++] = dims_[k];
+            }
+            return MdView<T, Layout, V - 1, E...>(data_, origin, extents, dims);
+        }
+        // Обход двумерного окна блоками BR x BC: f(block, i, j) получает
+        // подокно-блок и индексы его левого верхнего элемента, крайние блоки
+        // могут быть меньше.
+        template <size_t BR, size_t BC, class F>
+        constexpr void for_each_block(F f) const {
+            static_assert(V == 2 && BR > 0 && BC > 0, "for_each_block needs a 2D view and a non-empty block");
+            for (size_t i = 0; i < extents_[0]; i += BR)
+                for (size_t j = 0; j < extents_[1]; j += BC)
+                    f(sub({ i, j }, { std::min(BR, extents_[0] - i), std::min(BC, extents_[1] - j) }), i, j);
+        }
+    };
+
+    // Многомерный массив фиксированного размера поверх хранилища Array.
+    // Раскладка задаётся политикой Layout; MdArray<T, E...> — построчная.
+    // operator() проверяет индексы только assert'ом, at() бросает
+    // out_of_range.
+    template <class T, class Layout, size_t... E>
+    class BasicMdArray {
+        static_assert(sizeof...(E) > 0 && ((E > 0) && ...), "Extents must be positive");
+        static constexpr size_t R = sizeof...(E);
+        static constexpr size_t storage_size = Layout::template required_size<E...>;
+
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using index_type = Array<size_t, R, UncheckedBounds>;
+        using view_type = MdView<T, Layout, R, E...>;
+        using const_view_type = MdView<const T, Layout, R, E...>;
+        using layout_type = Layout;
+
+    private:
+        Array<T, storage_size, UncheckedBounds> data_;
+
+        static constexpr index_type all_dims() noexcept {
+            index_type dims;
+            for (size_t k = 0; k < R; k++)
+                dims[k] = k;
+            return dims;
+        }
+
+    public:
+        static constexpr size_t rank() noexcept { return R; }
+        static constexpr size_t extent(size_t k) noexcept { return index_type{ E... }[k]; }
+        static constexpr size_t size() noexcept { return (E * ...); }
+
+        template <class... Idx>
+            requires (sizeof...(Idx) == R)
+        constexpr reference operator()(Idx... i) noexcept {
+            assert(((size_t(i) < E) && ...));
+            return data_[Layout::template offset<E...>(index_type{ size_t(i)... })];
+        }
+        template <class... Idx>
+            requires (sizeof...(Idx) == R)
+        constexpr const_reference operator()(Idx... i) const noexcept {
+            assert(((size_t(i) < E) && ...));
+            return data_[Layout::template offset<E...>(index_type{ size_t(i)... })];
+        }
+        template <class... Idx>
+            requires (sizeof...(Idx) == R)
+        constexpr reference at(Idx... i) {
+            if (!((size_t(i) < E) && ...))
+                throw out_of_range("Index out of range");
+            return (*this)(i...);
+        }
+        template <class... Idx>
+            requires (sizeof...(Idx) == R)
+        constexpr const_reference at(Idx... i) const {
+            if (!((size_t(i) < E) && ...))
+                throw out_of_range("Index out of range");
+            return (*this)(i...);
+        }
+
+        // Хранилище в порядке раскладки. Для Tiled в нём есть элементы
+        // дополнения, которые не соответствуют никакому индексу.
+        constexpr T* data() noexcept { return data_.data(); }
+        constexpr const T* data() const noexcept { return data_.data(); }
+        constexpr void fill(const_reference val) { data_.fill(val); }
+
+        constexpr view_type view() noexcept { return view_type(data(), index_type{}, index_type{ E... }, all_dims()); }
+        constexpr const_view_type view() const noexcept { return const_view_type(data(), index_type{}, index_type{ E... }, all_dims()); }
+        constexpr view_type sub(const index_type& first, const index_type& extents) noexcept { return view().sub(first, extents); }
+        constexpr const_view_type sub(const index_type& first, const index_type& extents) const noexcept { return view().sub(first, extents); }
+        template <size_t D>
+        constexpr auto slice(size_t i) noexcept { return view().template slice<D>(i); }
+        template <size_t D>
+        constexpr auto slice(size_t i) const noexcept { return view().template slice<D>(i); }
+        template <size_t BR, size_t BC, class F>
+        constexpr void for_each_block(F f) { view().template for_each_block<BR, BC>(f); }
+        template <size_t BR, size_t BC, class F>
+        constexpr void for_each_block(F f) const { view().template for_each_block<BR, BC>(f); }
+    };
+
+    template <class T, size_t... E>
+    using MdArray = BasicMdArray<T, RowMajor, E...>;
 }
-#endif
\ No newline at end of file
+#endif
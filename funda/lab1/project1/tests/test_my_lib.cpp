@@ -2,6 +2,11 @@
 #include "my_lib.hpp"
 #include <exception>
 #include <iostream>
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <ranges>
+#include <string>
 using namespace std;
 using namespace my_container;
 
@@ -61,6 +66,46 @@ TEST(ArrayTest, test_swap) {
     }
 }
 
+TEST(ArrayTest, test_swap_paths) {
+    // Блочный обмен: несколько блоков и неполный хвост
+    Array<int, 100> a, b;
+    iota(a.begin(), a.end(), 0);
+    iota(b.begin(), b.end(), 1000);
+    swap(a, b);
+    for (size_t i = 0; i < a.size(); i++) {
+        ASSERT_EQ(a[i], int(1000 + i));
+        ASSERT_EQ(b[i], int(i));
+    }
+    a.swap(a);
+    ASSERT_EQ(a[99], 1099);
+
+    // Строки обмениваются без копирования своих буферов
+    Array<string, 2> c = { string(100, 'c'), "x" };
+    Array<string, 2> d = { string(100, 'd'), "y" };
+    const char* buf = c[0].data();
+    std::swap(c, d);
+    ASSERT_EQ(d[0].data(), buf);
+    ASSERT_EQ(c[0], string(100, 'd'));
+    ASSERT_EQ(d[1], "x");
+    static_assert(is_nothrow_swappable_v<Array<string, 2>>);
+}
+
+TEST(ArrayTest, test_string_copy_move) {
+    Array<string, 2> a = { string(100, 'a'), "b" };
+    Array<string, 2> b(a);
+    ASSERT_EQ(b, a);
+    const char* buf = a[0].data();
+    Array<string, 2> c;
+    c = std::move(a);
+    ASSERT_EQ(c[0].data(), buf);
+    ASSERT_EQ(c[1], "b");
+    b = c;
+    ASSERT_EQ(b, c);
+    static_assert(is_nothrow_move_constructible_v<Array<string, 2>>);
+    static_assert(is_nothrow_move_assignable_v<Array<string, 2>>);
+    static_assert(is_trivially_copyable_v<Array<double, 4>>);
+}
+
 TEST(ArrayTest, test_data) {
     Array<int, 5> a = { 1, 2, 3 };
     int* pti = a.data();
@@ -333,6 +378,253 @@ TEST(ArrayTest, test_eq2) {
     ASSERT_EQ(b, a);
 }
 
+TEST(ArrayTest, test_std_algorithms) {
+    static_assert(contiguous_iterator<Array<int, 3>::iterator>);
+    static_assert(contiguous_iterator<Array<int, 3>::const_iterator>);
+    static_assert(ranges::contiguous_range<const Array<int, 3>>);
+
+    Array<int, 8> a{ 5, 3, 7, 1, 8, 2, 6, 4 };
+    sort(a.begin(), a.end());
+    ASSERT_TRUE(is_sorted(a.cbegin(), a.cend()));
+    auto it = lower_bound(a.cbegin(), a.cend(), 5);
+    ASSERT_EQ(it - a.cbegin(), 4);
+    ASSERT_EQ(it[1], 6);
+    Array<int, 8>::const_iterator cit = a.begin();
+    cit += 7;
+    ASSERT_EQ(*cit, 8);
+    ranges::reverse(a);
+    ASSERT_EQ(a.front(), 8);
+
+    const Array<int, 8>& ca = a;
+    int sum = 0;
+    for (int x : ca)
+        sum += x;
+    ASSERT_EQ(sum, 36);
+}
+
+TEST(ArrayTest, test_parallel_algorithms) {
+    Array<double, 4096> a;
+    iota(a.begin(), a.end(), 0.0);
+    reverse(a.begin(), a.end());
+    sort(execution::par, a.begin(), a.end());
+    ASSERT_EQ(a[10], 10);
+    transform(execution::par_unseq, a.begin(), a.end(), a.begin(), [](double x) { return 2 * x; });
+    ASSERT_EQ(reduce(execution::par, a.begin(), a.end()), 4095.0 * 4096);
+}
+
+// Таблица квадратов, отсортированная по убыванию, целиком на этапе компиляции
+constexpr Array<int, 8> make_table() {
+    Array<int, 8> table;
+    for (size_t i = 0; i < table.size(); i++)
+        table[i] = int(i * i);
+    my_container::sort(table, greater<>());
+    return table;
+}
+
+static_assert(!is_polymorphic_v<Array<int, 4>>);
+static_assert(sizeof(Array<int, 4>) == 4 * sizeof(int));
+
+TEST(ArrayTest, test_constexpr) {
+    static constexpr Array<int, 8> table = make_table();
+    static_assert(table[0] == 49 && table.back() == 0);
+    static_assert(my_container::accumulate(table, 0) == 140);
+    static_assert(*my_container::find(table, 25) == 25);
+    static_assert(my_container::find(table, 3) == table.end());
+    static_assert(table.size() == 8 && !table.empty());
+
+    constexpr Array<int, 3> a{ 1, 2 };
+    constexpr Array<int, 3> b{ 1, 2, 0 };
+    static_assert(a == b);
+    static_assert((a <=> Array<int, 3>{ 1, 3 }) < 0);
+
+    constexpr auto swapped = [] {
+        Array<int, 2> x{ 1, 2 };
+        Array<int, 2> y{ 3, 4 };
+        x.swap(y);
+        x.fill(x[0] + y[1]);
+        return x;
+    }();
+    static_assert(swapped == Array<int, 2>{ 5, 5 });
+
+    ASSERT_EQ(table[1], 36);
+    ASSERT_EQ(my_container::accumulate(table, string(), [](string acc, int v) { return acc + to_string(v % 10); }), "96569410");
+}
+
+TEST(ArrayTest, test_bounds_policy) {
+    Array<int, 3, CheckedBounds> checked{ 1, 2, 3 };
+    ASSERT_THROW(checked[3], std::out_of_range);
+    ASSERT_THROW(checked.at(7), std::out_of_range);
+    static_assert(!noexcept(checked[0]));
+
+    Array<int, 3, UncheckedBounds> unchecked{ 1, 2, 3 };
+    static_assert(noexcept(unchecked[0]) && noexcept(unchecked.front()));
+    unchecked[1] = 20;
+    ASSERT_EQ(unchecked.front() + unchecked[1] + unchecked.back(), 24);
+    ASSERT_EQ(my_container::accumulate(unchecked, 0), 24);
+
+    Array<int, 3, AssertBounds> asserted{ 4, 5, 6 };
+    static_assert(noexcept(asserted.at(0)));
+    ASSERT_EQ(asserted.at(2), 6);
+#ifndef NDEBUG
+    ASSERT_DEATH(asserted[3], "");
+#endif
+}
+
+TEST(ArrayTest, test_alignment) {
+    Array<float, 5, UncheckedBounds, 64> a{};
+    static_assert(alignof(decltype(a)) == 64);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(a.data()) % 64, 0u);
+    Array<double, 3, CheckedBounds, 32> b[3];
+    for (auto& x : b)
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(x.data()) % 32, 0u);
+    static_assert(alignof(Array<int, 4>) == alignof(int));
+}
+
+TEST(ArrayTest, test_elementwise) {
+    Array<int, 4> a{ 1, 2, 3, 4 };
+    Array<int, 4> b{ 8, 6, 4, 2 };
+    ASSERT_EQ(a + b, (Array<int, 4>{ 9, 8, 7, 6 }));
+    ASSERT_EQ(b - a, (Array<int, 4>{ 7, 4, 1, -2 }));
+    ASSERT_EQ(a * b, (Array<int, 4>{ 8, 12, 12, 8 }));
+    ASSERT_EQ(b / a, (Array<int, 4>{ 8, 3, 1, 0 }));
+    ASSERT_EQ(a * 3, (Array<int, 4>{ 3, 6, 9, 12 }));
+    ASSERT_EQ(2 * a, (Array<int, 4>{ 2, 4, 6, 8 }));
+    ASSERT_EQ(b / 2, (Array<int, 4>{ 4, 3, 2, 1 }));
+    ASSERT_EQ(min(a, b), (Array<int, 4>{ 1, 2, 3, 2 }));
+    ASSERT_EQ(max(a, b), (Array<int, 4>{ 8, 6, 4, 4 }));
+
+    Array<int, 4> c = a;
+    c += b;
+    c -= a;
+    ASSERT_EQ(c, b);
+    c *= a;
+    c /= b;
+    ASSERT_EQ(c, a);
+
+    static_assert(dot(Array<int, 3>{ 1, 2, 3 }, Array<int, 3>{ 4, 5, 6 }) == 32);
+    static_assert(sum(Array<int, 3>{ 1, 2, 3 } + Array<int, 3>{ 1, 1, 1 }) == 9);
+}
+
+TEST(ArrayTest, test_reductions) {
+    // Длины по обе стороны от числа полос и с неполным хвостом
+    Array<float, 3> small{ 1.5f, -2.0f, 4.0f };
+    ASSERT_FLOAT_EQ(sum(small), 3.5f);
+    ASSERT_FLOAT_EQ(min(small), -2.0f);
+    ASSERT_FLOAT_EQ(max(small), 4.0f);
+
+    Array<int, 1000, UncheckedBounds, 64> big;
+    Array<int, 1000, UncheckedBounds, 64> ones;
+    for (int i = 0; i < 1000; i++) {
+        big[i] = (i * 37) % 1001 - 500;
+        ones[i] = 1;
+    }
+    ASSERT_EQ(sum(big), std::accumulate(big.begin(), big.end(), 0));
+    ASSERT_EQ(dot(big, ones), sum(big));
+    ASSERT_EQ(min(big), *std::min_element(big.begin(), big.end()));
+    ASSERT_EQ(max(big), *std::max_element(big.begin(), big.end()));
+
+    Array<double, 37> d;
+    double expected = 0;
+    for (size_t i = 0; i < d.size(); i++) {
+        d[i] = 0.5 * double(i);
+        expected += d[i] * d[i];
+    }
+    ASSERT_DOUBLE_EQ(dot(d, d), expected);
+}
+
+TEST(MdArrayTest, test_layouts) {
+    MdArray<int, 2, 3> r;
+    BasicMdArray<int, ColumnMajor, 2, 3> c;
+    BasicMdArray<int, Tiled<2, 2>, 3, 5> t;
+    for (size_t i = 0; i < 2; i++)
+        for (size_t j = 0; j < 3; j++) {
+            r(i, j) = int(i * 10 + j);
+            c(i, j) = int(i * 10 + j);
+        }
+    // Построчно: 00 01 02 10 11 12, по столбцам: 00 10 01 11 02 12
+    ASSERT_EQ(r.data()[1], 1);
+    ASSERT_EQ(r.data()[3], 10);
+    ASSERT_EQ(c.data()[1], 10);
+    ASSERT_EQ(c.data()[4], 2);
+    ASSERT_EQ(r.size(), 6u);
+    ASSERT_EQ(r.extent(1), 3u);
+
+    // Плитки 2x2: первая плитка — (0,0) (0,1) (1,0) (1,1)
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 5; j++)
+            t(i, j) = int(i * 10 + j);
+    ASSERT_EQ(t.data()[2], 10);
+    ASSERT_EQ(t.data()[4], 2);
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 5; j++)
+            ASSERT_EQ(t(i, j), int(i * 10 + j));
+
+    MdArray<int, 2, 3, 4> cube;
+    cube(1, 2, 3) = 7;
+    ASSERT_EQ(cube.data()[23], 7);
+    ASSERT_EQ(as_const(cube).at(1, 2, 3), 7);
+    ASSERT_THROW(cube.at(2, 0, 0), out_of_range);
+}
+
+TEST(MdArrayTest, test_views) {
+    BasicMdArray<int, Tiled<2, 2>, 4, 5> m;
+    for (size_t i = 0; i < 4; i++)
+        for (size_t j = 0; j < 5; j++)
+            m(i, j) = int(i * 10 + j);
+
+    auto s = m.sub({ 1, 2 }, { 2, 3 });
+    ASSERT_EQ(s.extent(0), 2u);
+    ASSERT_EQ(s.size(), 6u);
+    ASSERT_EQ(s(0, 0), 12);
+    ASSERT_EQ(s(1, 2), 24);
+    // Окно не копирует: запись видна в массиве
+    s(1, 1) = -1;
+    ASSERT_EQ(m(2, 3), -1);
+
+    auto row = m.slice<0>(3);
+    auto col = m.slice<1>(4);
+    ASSERT_EQ(row.rank(), 1u);
+    ASSERT_EQ(row.extent(0), 5u);
+    ASSERT_EQ(row(2), 32);
+    ASSERT_EQ(col.extent(0), 4u);
+    ASSERT_EQ(col(1), 14);
+    ASSERT_EQ(s.slice<1>(2)(1), 24);
+    ASSERT_EQ(s.sub({ 1, 1 }, { 1, 2 })(0, 1), 24);
+
+    const auto& cm = m;
+    static_assert(is_same_v<decltype(cm.view()(0, 0)), const int&>);
+
+    MdArray<int, 2, 3, 4> cube;
+    cube.fill(0);
+    cube.slice<1>(2)(1, 3) = 5;
+    ASSERT_EQ(cube(1, 2, 3), 5);
+}
+
+TEST(MdArrayTest, test_blocks) {
+    MdArray<int, 5, 7> m;
+    m.fill(0);
+    size_t blocks = 0;
+    m.for_each_block<2, 3>([&](auto b, size_t i0, size_t j0) {
+        blocks++;
+        for (size_t i = 0; i < b.extent(0); i++)
+            for (size_t j = 0; j < b.extent(1); j++)
+                b(i, j) += int(i0 * 10 + j0);
+    });
+    ASSERT_EQ(blocks, 9u);
+    for (size_t i = 0; i < 5; i++)
+        for (size_t j = 0; j < 7; j++)
+            ASSERT_EQ(m(i, j), int(i / 2 * 20 + j / 3 * 3));
+
+    constexpr auto identity = [] {
+        MdArray<int, 3, 3> e;
+        e.fill(0);
+        for (size_t i = 0; i < 3; i++)
+            e(i, i) = 1;
+        return e;
+    }();
+    static_assert(identity(2, 2) == 1 && identity(0, 1) == 0);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
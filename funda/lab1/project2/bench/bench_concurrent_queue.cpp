@@ -0,0 +1,83 @@
+#include "my_lib.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+using namespace std;
+
+// Пропускная способность очереди: t производителей и t потребителей
+// передают items чисел. ConcurrentQueue против List под общим мьютексом.
+const size_t items = 1000000;
+
+struct LockedList {
+    mutex m;
+    my_container::List<int> list;
+
+    void push_back(int value) {
+        lock_guard lock(m);
+        list.push_back(value);
+    }
+    optional<int> try_pop_front() {
+        lock_guard lock(m);
+        if (list.empty()) {
+            return nullopt;
+        }
+        int value = list.front();
+        list.pop_front();
+        return value;
+    }
+};
+
+template <class Queue>
+double run(size_t threads) {
+    Queue queue;
+    atomic<size_t> popped = 0;
+    atomic<long long> check = 0;
+    vector<thread> pool;
+    auto start = chrono::steady_clock::now();
+    for (size_t p = 0; p < threads; p++) {
+        pool.emplace_back([&, p] {
+            for (size_t i = p; i < items; i += threads) {
+                queue.push_back(int(i));
+            }
+        });
+    }
+    for (size_t c = 0; c < threads; c++) {
+        pool.emplace_back([&] {
+            long long sum = 0;
+            while (popped.load(memory_order_relaxed) < items) {
+                if (auto value = queue.try_pop_front()) {
+                    sum += *value;
+                    popped.fetch_add(1, memory_order_relaxed);
+                }
+                else {
+                    this_thread::yield();
+                }
+            }
+            check += sum;
+        });
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    if (check != (long long)(items) * (items - 1) / 2) {
+        printf("checksum mismatch\n");
+    }
+    return items / sec / 1e6;
+}
+
+int main() {
+    size_t max_threads = max<size_t>(4, thread::hardware_concurrency());
+    printf("%zu items, %u hardware threads\n", items, thread::hardware_concurrency());
+    printf("%-24s %18s %18s\n", "producers+consumers", "ConcurrentQueue", "mutex + List");
+    for (size_t t = 1; t <= max_threads; t *= 2) {
+        double lock_free = run<my_container::ConcurrentQueue<int>>(t);
+        double locked = run<LockedList>(t);
+        printf("%10zu + %-11zu %12.2f Mop/s %12.2f Mop/s\n", t, t, lock_free, locked);
+    }
+    return 0;
+}
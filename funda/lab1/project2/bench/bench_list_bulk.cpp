@@ -0,0 +1,60 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <vector>
+using namespace std;
+
+// Загрузка и сброс списка из 1M элементов: поэлементно против конструктора
+// из диапазона и clear, освобождающего пул целиком.
+const size_t len = 1000000;
+const size_t rounds = 10;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; r++) {
+        f();
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / rounds;
+}
+
+int main() {
+    using namespace my_container;
+    vector<int> values(len);
+    for (size_t i = 0; i < len; i++) {
+        values[i] = int(i);
+    }
+    printf("%zu ints, load + clear, ms per round\n", len);
+
+    double std_list = measure([&] {
+        list<int> l(values.begin(), values.end());
+        l.clear();
+    });
+    printf("%-30s %8.2f\n", "std::list", std_list);
+
+    double one_by_one = measure([&] {
+        auto pool = make_shared<List<int>::pool_type>();
+        List<int> l(pool);
+        for (int x : values) {
+            l.push_back(x);
+        }
+        l.clear();
+    });
+    printf("%-30s %8.2f\n", "List push_back, shared pool", one_by_one);
+
+    double bulk = measure([&] {
+        List<int> l(values.begin(), values.end());
+        l.clear();
+    });
+    printf("%-30s %8.2f\n", "List(first, last), own pool", bulk);
+
+    double fill = measure([&] {
+        List<int> l(len, 7);
+        l.assign(len, 8);
+        l.clear();
+    });
+    printf("%-30s %8.2f\n", "List(n, v) + assign(n, v)", fill);
+    return 0;
+}
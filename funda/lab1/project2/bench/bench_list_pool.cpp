@@ -0,0 +1,65 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <memory>
+using namespace std;
+
+// Узлы из пула против отдельного new/delete на каждый узел (std::list).
+// churn — очередь фиксированной длины: pop_front + push_back;
+// traverse — проход по списку, построенному вперемешку с другим списком.
+const size_t len = 100000;
+const size_t churn_rounds = 20;
+const size_t traverse_rounds = 50;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <class L>
+void run(const char* name, L& list, L& other) {
+    for (size_t i = 0; i < len; i++) {
+        list.push_back(int(i));
+        other.push_back(int(i));
+    }
+    long long check = 0;
+    double churn = measure([&] {
+        for (size_t r = 0; r < churn_rounds; r++) {
+            for (size_t i = 0; i < len; i++) {
+                check += list.front();
+                list.pop_front();
+                list.push_back(int(i));
+            }
+        }
+    });
+    double traverse = measure([&] {
+        for (size_t r = 0; r < traverse_rounds; r++) {
+            for (auto it = list.begin(); it != list.end(); ++it) {
+                check += *it;
+            }
+        }
+    });
+    printf("%-22s churn %9.2f ms  traverse %9.2f ms  check=%lld\n", name, churn, traverse, check);
+}
+
+int main() {
+    using namespace my_container;
+    printf("%zu nodes, %zu churn rounds, %zu traversals\n", len, churn_rounds, traverse_rounds);
+    {
+        list<int> a, b;
+        run("std::list", a, b);
+    }
+    {
+        List<int> a, b;
+        run("List, own pools", a, b);
+    }
+    {
+        auto pool = make_shared<List<int>::pool_type>();
+        List<int> a(pool), b(pool);
+        run("List, shared pool", a, b);
+    }
+    return 0;
+}
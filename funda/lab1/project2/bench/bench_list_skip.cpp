@@ -0,0 +1,87 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+using namespace std;
+
+// Позиционный доступ и поиск в отсортированной последовательности:
+// IndexedSkipList (O(log n)) против прохода по List (O(n)).
+const size_t len = 100000;
+const size_t queries = 2000;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    using namespace my_container;
+    mt19937 rng(3);
+    vector<size_t> positions(queries);
+    for (size_t& k : positions) {
+        k = rng() % len;
+    }
+    printf("%zu sorted ints, %zu queries\n", len, queries);
+
+    List<int> list;
+    IndexedSkipList<int> skip;
+    for (size_t i = 0; i < len; i++) {
+        list.push_back(int(2 * i));
+        skip.push_back(int(2 * i));
+    }
+
+    long long check = 0;
+    double list_nth = measure([&] {
+        for (size_t k : positions) {
+            auto it = list.begin();
+            for (size_t i = 0; i < k; i++) {
+                ++it;
+            }
+            check += *it;
+        }
+    });
+    double skip_nth = measure([&] {
+        for (size_t k : positions) {
+            check += skip[k];
+        }
+    });
+    printf("%-16s List %9.2f ms   IndexedSkipList %9.3f ms\n", "nth(k)", list_nth, skip_nth);
+
+    double list_lb = measure([&] {
+        for (size_t k : positions) {
+            int value = int(k) | 1;
+            auto it = list.begin();
+            while (it != list.end() && *it < value) {
+                ++it;
+            }
+            check += *it;
+        }
+    });
+    double skip_lb = measure([&] {
+        for (size_t k : positions) {
+            check += *skip.lower_bound(int(k) | 1);
+        }
+    });
+    printf("%-16s List %9.2f ms   IndexedSkipList %9.3f ms\n", "lower_bound", list_lb, skip_lb);
+
+    double list_ins = measure([&] {
+        for (size_t k : positions) {
+            auto it = list.begin();
+            for (size_t i = 0; i < k; i++) {
+                ++it;
+            }
+            list.insert(it, -1);
+        }
+    });
+    double skip_ins = measure([&] {
+        for (size_t k : positions) {
+            skip.insert(skip.nth(k), -1);
+        }
+    });
+    printf("%-16s List %9.2f ms   IndexedSkipList %9.3f ms\n", "insert at k", list_ins, skip_ins);
+    printf("check=%lld\n", check);
+    return 0;
+}
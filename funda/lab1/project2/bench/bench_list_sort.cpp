@@ -0,0 +1,56 @@
+#include "my_lib.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <vector>
+using namespace std;
+
+// Сортировка списка из 1M узлов: перецепление узлов (List::sort, std::list::sort)
+// против копирования в вектор, std::stable_sort и обратной записи.
+const size_t len = 1000000;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <class L, class S>
+void run(const char* name, const vector<int>& input, S sort_list) {
+    L list;
+    for (int x : input) {
+        list.push_back(x);
+    }
+    double ms = measure([&] { sort_list(list); });
+    bool sorted = is_sorted(list.begin(), list.end());
+    printf("%-28s %9.2f ms  sorted=%d\n", name, ms, sorted);
+}
+
+int main() {
+    using namespace my_container;
+    mt19937 rng(42);
+    vector<int> input(len);
+    for (int& x : input) {
+        x = int(rng());
+    }
+    printf("%zu random ints\n", len);
+
+    run<list<int>>("std::list::sort", input, [](list<int>& l) { l.sort(); });
+    run<List<int>>("List::sort", input, [](List<int>& l) { l.sort(); });
+    run<List<int>>("List -> vector -> List", input, [](List<int>& l) {
+        vector<int> tmp;
+        tmp.reserve(l.size());
+        for (auto it = l.begin(); it != l.end(); ++it) {
+            tmp.push_back(*it);
+        }
+        stable_sort(tmp.begin(), tmp.end());
+        auto it = l.begin();
+        for (int x : tmp) {
+            *it++ = x;
+        }
+    });
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+using namespace std;
+
+// Проход по 10M элементов: List, чьи узлы идут в памяти подряд (сразу после
+// заполнения из пула) и вразброс (после сортировки по случайному ключу),
+// против UnrolledList.
+const size_t len = 10000000;
+const size_t rounds = 5;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <class L>
+void traverse(const char* name, const L& list) {
+    long long check = 0;
+    double ms = measure([&] {
+        for (size_t r = 0; r < rounds; r++) {
+            for (auto it = list.cbegin(); it != list.cend(); ++it) {
+                check += *it;
+            }
+        }
+    });
+    printf("%-24s %9.2f ms/pass  check=%lld\n", name, ms / rounds, check);
+}
+
+int main() {
+    using namespace my_container;
+    printf("%zu ints, %zu passes\n", len, rounds);
+    mt19937 rng(7);
+
+    List<int> list;
+    for (size_t i = 0; i < len; i++) {
+        list.push_back(int(rng() % 1000));
+    }
+    traverse("List, sequential nodes", list);
+    list.sort();
+    traverse("List, scattered nodes", list);
+
+    UnrolledList<int> unrolled;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+        unrolled.push_back(*it);
+    }
+    traverse("UnrolledList", unrolled);
+    return 0;
+}
@@ -3,9 +3,21 @@
 #include <iostream>
 #include <exception>
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 template <class T>
 class Container {
@@ -38,6 +50,143 @@ Container<T>::~Container() = default;
 
 namespace my_container {
 
+    // Пул объектов одного типа: память берётся кусками по нескольку слотов,
+    // освобождённые слоты попадают в список свободных и выдаются повторно.
+    // Куски возвращаются системе только при разрушении пула. Пул не
+    // потокобезопасен.
+    template<class T>
+    class NodePool {
+    private:
+        union Slot {
+            Slot* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        Slot* _free = nullptr;
+        Slot* _chunks = nullptr;
+        Slot* _cur = nullptr;
+        Slot* _end = nullptr;
+        size_t _chunk_size;
+        size_t _max_chunk_size;
+        size_t _chunk_count = 0;
+        size_t _free_count = 0;
+
+        // Первый слот куска хранит ссылку на предыдущий кусок.
+        void _grow(size_t count) {
+            Slot* chunk = static_cast<Slot*>(::operator new(sizeof(Slot) * (count + 1), std::align_val_t(alignof(Slot))));
+            chunk->next = _chunks;
+            _chunks = chunk;
+            _cur = chunk + 1;
+            _end = _cur + count;
+            ++_chunk_count;
+            _chunk_size = std::min(_chunk_size * 2, _max_chunk_size);
+        }
+
+    public:
+        explicit NodePool(size_t first_chunk_size = 32, size_t max_chunk_size = 4096)
+            : _chunk_size(std::max<size_t>(first_chunk_size, 1)), _max_chunk_size(std::max(max_chunk_size, first_chunk_size)) {}
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+        ~NodePool() { reset(); }
+
+        void* allocate() {
+            if (_free != nullptr) {
+                Slot* slot = _free;
+                _free = slot->next;
+                --_free_count;
+                return slot;
+            }
+            if (_cur == _end) {
+                _grow(_chunk_size);
+            }
+            return _cur++;
+        }
+        void deallocate(void* ptr) noexcept {
+            Slot* slot = static_cast<Slot*>(ptr);
+            slot->next = _free;
+            _free = slot;
+            ++_free_count;
+        }
+        // Гарантирует, что следующие count выделений обойдутся без обращения
+        // к системе: недостающие слоты берутся одним куском, остаток текущего
+        // куска уходит в список свободных.
+        void reserve(size_t count) {
+            if (_free_count + size_t(_end - _cur) >= count) {
+                return;
+            }
+            while (_cur != _end) {
+                deallocate(_cur++);
+            }
+            _grow(std::max(count - _free_count, _chunk_size));
+        }
+        // Возвращает системе все куски разом. Все выданные слоты становятся
+        // недействительными.
+        void reset() noexcept {
+            while (_chunks != nullptr) {
+                Slot* next = _chunks->next;
+                ::operator delete(_chunks, std::align_val_t(alignof(Slot)));
+                _chunks = next;
+            }
+            _free = nullptr;
+            _cur = nullptr;
+            _end = nullptr;
+            _chunk_count = 0;
+            _free_count = 0;
+        }
+        // Забирает куски other вместе со свободными слотами; other остаётся
+        // пустым. Слоты, выданные из other, после этого возвращаются сюда.
+        // Стоимость — число кусков other плюс длина более короткого из
+        // списков свободных.
+        void absorb(NodePool& other) noexcept {
+            if (this == &other || other._chunks == nullptr) {
+                return;
+            }
+            Slot* last = other._chunks;
+            while (last->next != nullptr) {
+                last = last->next;
+            }
+            last->next = _chunks;
+            _chunks = other._chunks;
+
+            Slot* shorter = _free;
+            Slot* longer = other._free;
+            if (_free_count > other._free_count) {
+                std::swap(shorter, longer);
+            }
+            if (shorter != nullptr) {
+                Slot* tail = shorter;
+                while (tail->next != nullptr) {
+                    tail = tail->next;
+                }
+                tail->next = longer;
+                _free = shorter;
+            }
+            else {
+                _free = longer;
+            }
+            _free_count += other._free_count;
+
+            // Из двух непочатых остатков кусков продолжаем более длинный
+            if (other._end - other._cur > _end - _cur) {
+                std::swap(_cur, other._cur);
+                std::swap(_end, other._end);
+            }
+            while (other._cur != other._end) {
+                deallocate(other._cur++);
+            }
+            _chunk_count += other._chunk_count;
+            _chunk_size = std::max(_chunk_size, std::min(other._chunk_size, _max_chunk_size));
+
+            other._free = nullptr;
+            other._chunks = nullptr;
+            other._cur = nullptr;
+            other._end = nullptr;
+            other._chunk_count = 0;
+            other._free_count = 0;
+        }
+        size_t chunks() const noexcept { return _chunk_count; }
+    };
+
     template<class T>
     class List : public Container<T> {
     private:
@@ -46,36 +195,140 @@ namespace my_container {
             T data;
             Node* next;
             Node* prev;
-            Node() : data(T{}), next(nullptr), prev(nullptr) {}
-            Node(T& _data) : data(_data), next(nullptr), prev(nullptr) {}
-            Node(const T& _data) : data(_data), next(nullptr), prev(nullptr) {}
-            Node(const T& _data, const Node*& prev, const Node*& next) : data(_data), next(next), prev(prev) {}
-            Node(const T& _data, Node*& prev, Node*& next) : data(_data), next(next), prev(prev) {}
-            Node(const T& _data, Node** prev, Node** next) : data(_data) {
-                this->prev = (prev == nullptr) ? nullptr : *prev;
-                this->next = (next == nullptr) ? nullptr : *next;
-            }
+            template<class... Args>
+            explicit Node(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
             ~Node() = default;
         };
 
+    public:
+        // Узлы берутся из пула; пул можно передать в конструктор и разделить
+        // между списками, иначе список создаёт свой при первой вставке.
+        // Пул не потокобезопасен, поэтому копия списка заводит собственный;
+        // общий пул передаётся только явно.
+        using pool_type = NodePool<Node>;
+
     private:
         Node* _head;
         Node* _tail;
         size_t _size;
+        std::shared_ptr<pool_type> _pool;
 
         Node* _begin() const noexcept { return _head; }
         const Node* _cbegin() const noexcept { return _head; }
-        Node* _end() const noexcept { return _tail->next; }
-        const Node* _cend() const noexcept { return _tail->next; }
-        Node* _rend() const noexcept { return _begin()->prev; }
-        const Node* _crend() const noexcept { return _cbegin()->prev; }
+        Node* _end() const noexcept { return nullptr; }
+        const Node* _cend() const noexcept { return nullptr; }
+        Node* _rend() const noexcept { return nullptr; }
+        const Node* _crend() const noexcept { return nullptr; }
         Node* _rbegin() const noexcept { return _tail; }
         const Node* _crbegin() const noexcept { return _tail; }
 
+        template<class... Args>
+        Node* _create(Args&&... args) {
+            if (!_pool) {
+                _pool = std::make_shared<pool_type>();
+            }
+            void* place = _pool->allocate();
+            try {
+                return ::new (place) Node(std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                _pool->deallocate(place);
+                throw;
+            }
+        }
+        void _destroy(Node* node) noexcept {
+            node->~Node();
+            _pool->deallocate(node);
+        }
+        // Место под count узлов выделяется заранее одним куском
+        void _reserve(size_t count) {
+            if (count == 0) {
+                return;
+            }
+            if (!_pool) {
+                _pool = std::make_shared<pool_type>();
+            }
+            _pool->reserve(count);
+        }
+        template<class It>
+        void _append(It first, It last) {
+            if constexpr (std::forward_iterator<It>) {
+                _reserve(size_t(std::distance(first, last)));
+            }
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+
+        void _link_before(Node* node, Node* next) noexcept {
+            Node* prev = (next == nullptr) ? _tail : next->prev;
+            node->prev = prev;
+            node->next = next;
+            ((prev == nullptr) ? _head : prev->next) = node;
+            ((next == nullptr) ? _tail : next->prev) = node;
+        }
+        void _unlink(Node* node) noexcept {
+            ((node->prev == nullptr) ? _head : node->prev->next) = node->next;
+            ((node->next == nullptr) ? _tail : node->next->prev) = node->prev;
+        }
+
+        // Узлы можно перецеплять между списками только при общем пуле,
+        // иначе узел вернулся бы в чужой пул. Пустой список без пула
+        // перенимает пул другого; если один из пулов больше никем не
+        // используется, он вливается в другой, и дальше оба списка делят
+        // получившийся пул. false — пулы разделены с третьими списками.
+        bool _share_pool(List<T>& other) noexcept {
+            if (_pool == other._pool) {
+                return true;
+            }
+            if (!_pool && _size == 0) {
+                _pool = other._pool;
+                return true;
+            }
+            if (other._pool.use_count() == 1) {
+                _pool->absorb(*other._pool);
+                other._pool = _pool;
+                return true;
+            }
+            if (_pool.use_count() == 1) {
+                other._pool->absorb(*_pool);
+                _pool = other._pool;
+                return true;
+            }
+            return false;
+        }
+
+        // Слияние двух отсортированных цепочек по next; при равенстве первым
+        // идёт узел из a, поэтому слияние устойчиво.
+        template<class Compare>
+        static Node* _merge_chains(Node* a, Node* b, Compare& comp) {
+            Node* head = nullptr;
+            Node** tail = &head;
+            while (a != nullptr && b != nullptr) {
+                if (comp(b->data, a->data)) {
+                    *tail = b;
+                    b = b->next;
+                }
+                else {
+                    *tail = a;
+                    a = a->next;
+                }
+                tail = &(*tail)->next;
+            }
+            *tail = (a != nullptr) ? a : b;
+            return head;
+        }
+
     public:
 
         class Iterator {
         public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
             Node* ptr;
             Iterator() : ptr(nullptr) {}
             Iterator(Node* ptr) : ptr(ptr) {}
@@ -149,6 +402,12 @@ namespace my_container {
 
         class ConstIterator {
         public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
             const Node* ptr;
             ConstIterator() : ptr(nullptr) {}
             ConstIterator(const Node* ptr) : ptr(ptr) {}
@@ -225,6 +484,12 @@ namespace my_container {
 
         class ReverseIterator {
         public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
             Node* ptr;
             ReverseIterator() : ptr(nullptr) {}
             ReverseIterator(Node* ptr) : ptr(ptr) {}
@@ -300,6 +565,12 @@ namespace my_container {
 
         class ConstReverseIterator {
         public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
             const Node* ptr;
             ConstReverseIterator() : ptr(nullptr) {}
             ConstReverseIterator(const Node* ptr) : ptr(ptr) {}
@@ -383,44 +654,62 @@ namespace my_container {
         using const_reverse_iterator = ConstReverseIterator;
 
 
-        List() {
-            _head = new Node();
-            _tail = _head;
-            _size = 0;
+        List() : _head(nullptr), _tail(nullptr), _size(0) {}
+        explicit List(std::shared_ptr<pool_type> pool) : _head(nullptr), _tail(nullptr), _size(0), _pool(std::move(pool)) {}
+        List(const std::initializer_list<T>& initList, std::shared_ptr<pool_type> pool = nullptr) : List(std::move(pool)) {
+            _append(initList.begin(), initList.end());
         }
-        List(const std::initializer_list<T>& initList) {
-            _size = initList.size();
-            if (_size == 0) {
-                _head = new Node();
-                _tail = _head;
-            }
-            else {
-                _head = new Node(*initList.begin());
-                Node* cur = _head;
-                _tail = _head;
-                for (auto i = initList.begin() + 1; i != initList.end(); i++) {
-                    cur->next = new Node(*i, &cur, nullptr);
-                    _tail = cur->next;
-                    cur = cur->next;
-                }
-            }
+        template<std::input_iterator It>
+        List(It first, It last, std::shared_ptr<pool_type> pool = nullptr) : List(std::move(pool)) { _append(first, last); }
+        List(size_t count, const T& element, std::shared_ptr<pool_type> pool = nullptr) : List(std::move(pool)) { resize(count, element); }
+        List(const List<T>& copy) : List() { _append(copy.cbegin(), copy.cend()); }
+        List(const List<T>& copy, std::shared_ptr<pool_type> pool) : List(std::move(pool)) { _append(copy.cbegin(), copy.cend()); }
+        // Перемещение забирает цепочку узлов вместе с пулом.
+        List(List<T>&& other) noexcept
+            : _head(std::exchange(other._head, nullptr)), _tail(std::exchange(other._tail, nullptr)), _size(std::exchange(other._size, 0)), _pool(std::move(other._pool)) {}
+        // Копирующее присваивание и assign переиспользуют уже имеющиеся узлы:
+        // значения присваиваются поверх, лишние узлы удаляются, недостающие
+        // создаются.
+        List& operator=(const List<T>& other) {
+            if (this != &other) {
+                assign(other.cbegin(), other.cend());
+            }
+            return *this;
         }
-        List(const List<T>& copy) {
-            _head = new Node();
-            _tail = _head;
-            _size = 0;
-            for (auto i = copy.cbegin(); i != copy.cend(); i++) {
-                push_back(*i);
+        // count копий element; имеющиеся узлы переиспользуются
+        void assign(size_t count, const T& element) {
+            Node* cur = _head;
+            for (size_t i = 0; i < count && cur != nullptr; i++, cur = cur->next) {
+                cur->data = element;
             }
+            resize(count, element);
         }
-        ~List() noexcept override final {
+        template<std::input_iterator It>
+        void assign(It first, It last) {
             Node* cur = _head;
+            for (; first != last && cur != nullptr; ++first, cur = cur->next) {
+                cur->data = *first;
+            }
             while (cur != nullptr) {
-                _head = _head->next;
-                delete cur;
-                cur = _head;
+                Node* next = cur->next;
+                erase(iterator(cur));
+                cur = next;
             }
+            _append(first, last);
+        }
+        List& operator=(List<T>&& other) noexcept {
+            if (this != &other) {
+                clear();
+                _head = std::exchange(other._head, nullptr);
+                _tail = std::exchange(other._tail, nullptr);
+                _size = std::exchange(other._size, 0);
+                _pool = std::move(other._pool);
+            }
+            return *this;
         }
+        ~List() noexcept override final { clear(); }
+
+        std::shared_ptr<pool_type> pool() const noexcept { return _pool; }
 
         reverse_iterator rbegin() const noexcept { return reverse_iterator(_rbegin()); }
         const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(_crbegin()); }
@@ -477,76 +766,62 @@ namespace my_container {
         bool operator<=(const List<T>& other) const { return !(*this > other); }
         bool operator>=(const List<T>& other) const { return !(*this < other); }
 
-        void clear() {
-            if (_size == 0) {
-                return;
+        // Если пул принадлежит только этому списку, его куски освобождаются
+        // разом; для тривиально разрушаемых T узлы при этом не обходятся
+        // вовсе. С общим пулом узлы по одному возвращаются в список свободных.
+        void clear() noexcept {
+            if (_pool.use_count() == 1) {
+                if constexpr (!std::is_trivially_destructible_v<T>) {
+                    for (Node* cur = _head; cur != nullptr; cur = cur->next) {
+                        cur->~Node();
+                    }
+                }
+                _pool->reset();
             }
-            while (_tail != _head) {
-                _tail = _tail->prev;
-                delete _tail->next;
-                _tail->next = nullptr;
+            else {
+                Node* cur = _head;
+                while (cur != nullptr) {
+                    Node* next = cur->next;
+                    _destroy(cur);
+                    cur = next;
+                }
             }
+            _head = nullptr;
+            _tail = nullptr;
             _size = 0;
         }
-        void insert(iterator position, const T& element) noexcept {
-            Node* save = position.ptr;
-            position.ptr->prev->next = new Node(element, position.ptr->prev, save);
-            if (save != nullptr) {
-                save->prev = position.ptr->next;
-            }
+        // Вставка перед position; end() означает вставку в конец. Элемент
+        // конструируется прямо в узле из аргументов.
+        template<class... Args>
+        iterator emplace(iterator position, Args&&... args) {
+            Node* node = _create(std::forward<Args>(args)...);
+            _link_before(node, position.ptr);
             ++_size;
-            if (position == _tail) {
-                _tail = position.ptr;
-            }
+            return iterator(node);
         }
+        template<class... Args>
+        T& emplace_back(Args&&... args) { return *emplace(end(), std::forward<Args>(args)...); }
+        template<class... Args>
+        T& emplace_front(Args&&... args) { return *emplace(begin(), std::forward<Args>(args)...); }
+        void insert(iterator position, const T& element) { emplace(position, element); }
+        void insert(iterator position, T&& element) { emplace(position, std::move(element)); }
         void erase(iterator position) noexcept {
-            position.ptr->prev->next = position.ptr->next;
-            delete position.ptr;
-            position.ptr = nullptr;
+            _unlink(position.ptr);
+            _destroy(position.ptr);
             --_size;
         }
-        void push_back(const T& element) noexcept {
-            if (_size == 0) {
-                _head->data = element;
-            }
-            else {
-                _tail->next = new Node(element, &_tail, nullptr);
-                _tail = _tail->next;
-            }
-            ++_size;
-        }
+        void push_back(const T& element) { emplace(end(), element); }
+        void push_back(T&& element) { emplace(end(), std::move(element)); }
         void pop_back() noexcept {
-            if (_size == 0) {
-                std::out_of_range("There are no elements!\n");
-            }
-            else if (_size == 1) {
-                _head = _tail;
-            }
-            else {
-                _tail = _tail->prev;
-                delete _tail->next;
-                _tail->next = nullptr;
+            if (_size != 0) {
+                erase(iterator(_tail));
             }
-            --_size;
-        }
-        void push_front(const T& element) noexcept {
-            Node* newNode = new Node(element, nullptr, &_head);
-            _head->prev = newNode;
-            _head = newNode;
-            ++_size;
         }
-        void pop_front() {
-            if (_size == 0) {
-                std::out_of_range("There are no elements!\n");
-            }
-            else if (_size == 1) {
-                --_size;
-            }
-            else {
-                _head = _head->next;
-                delete _head->prev;
-                _head->prev = nullptr;
-                --_size;
+        void push_front(const T& element) { emplace(begin(), element); }
+        void push_front(T&& element) { emplace(begin(), std::move(element)); }
+        void pop_front() noexcept {
+            if (_size != 0) {
+                erase(iterator(_head));
             }
         }
 
@@ -556,10 +831,7 @@ namespace my_container {
             }
             else if (_size > elNumber) {
                 while (_size != elNumber) {
-                    _tail = _tail->prev;
-                    delete _tail->next;
-                    _tail->next = nullptr;
-                    --_size;
+                    pop_back();
                 }
             }
             else {
@@ -574,12 +846,115 @@ namespace my_container {
                 resize(elNumber);
             }
             else {
+                _reserve(elNumber - _size);
                 while (_size != elNumber) {
                     push_back(el);
                 }
             }
         }
 
+        // Перенос узлов other перед position. Узлы перецепляются за O(1)
+        // (для диапазона из другого списка — плюс подсчёт его длины), пулы
+        // при необходимости объединяются, см. _share_pool. Только если оба
+        // пула разделены с третьими списками, элементы перемещаются в новые
+        // узлы и удаляются из other.
+        void splice(iterator position, List<T>& other) {
+            if (this != &other) {
+                splice(position, other, other.begin(), other.end());
+            }
+        }
+        void splice(iterator position, List<T>& other, iterator it) {
+            iterator last = it;
+            ++last;
+            splice(position, other, it, last);
+        }
+        void splice(iterator position, List<T>& other, iterator first, iterator last) {
+            // Перенос диапазона на его же место ничего не меняет
+            if (first == last || (this == &other && (position == first || position == last))) {
+                return;
+            }
+            if (!_share_pool(other)) {
+                while (first != last) {
+                    insert(position, std::move(*first));
+                    other.erase(first++);
+                }
+                return;
+            }
+            Node* from = first.ptr;
+            Node* to = (last.ptr == nullptr) ? other._tail : last.ptr->prev;
+            if (this != &other) {
+                size_t count = 1;
+                for (Node* cur = from; cur != to; cur = cur->next) {
+                    ++count;
+                }
+                other._size -= count;
+                _size += count;
+            }
+            ((from->prev == nullptr) ? other._head : from->prev->next) = last.ptr;
+            ((last.ptr == nullptr) ? other._tail : last.ptr->prev) = from->prev;
+
+            Node* next = position.ptr;
+            Node* prev = (next == nullptr) ? _tail : next->prev;
+            from->prev = prev;
+            to->next = next;
+            ((prev == nullptr) ? _head : prev->next) = from;
+            ((next == nullptr) ? _tail : next->prev) = to;
+        }
+
+        // Слияние двух отсортированных списков за O(size() + other.size());
+        // other остаётся пустым, равные элементы *this идут первыми.
+        template<class Compare = std::less<>>
+        void merge(List<T>& other, Compare comp = Compare{}) {
+            if (this == &other) {
+                return;
+            }
+            Node* pos = _head;
+            while (other._size != 0) {
+                while (pos != nullptr && !comp(other._head->data, pos->data)) {
+                    pos = pos->next;
+                }
+                splice(iterator(pos), other, iterator(other._head));
+            }
+        }
+
+        // Устойчивая сортировка слиянием снизу вверх за O(n log n): узлы
+        // перецепляются, сами элементы не копируются и не перемещаются,
+        // итераторы остаются действительными. bins[i] хранит отсортированную
+        // цепочку из 2^i узлов. Компаратор не должен бросать исключений.
+        template<class Compare = std::less<>>
+        void sort(Compare comp = Compare{}) {
+            if (_size < 2) {
+                return;
+            }
+            Node* bins[64] = {};
+            Node* cur = _head;
+            while (cur != nullptr) {
+                Node* run = cur;
+                cur = cur->next;
+                run->next = nullptr;
+                size_t i = 0;
+                for (; bins[i] != nullptr; i++) {
+                    run = _merge_chains(bins[i], run, comp);
+                    bins[i] = nullptr;
+                }
+                bins[i] = run;
+            }
+            // В старших корзинах лежат более ранние элементы
+            Node* result = nullptr;
+            for (Node* bin : bins) {
+                if (bin != nullptr) {
+                    result = (result == nullptr) ? bin : _merge_chains(bin, result, comp);
+                }
+            }
+            _head = result;
+            Node* prev = nullptr;
+            for (cur = result; cur != nullptr; cur = cur->next) {
+                cur->prev = prev;
+                prev = cur;
+            }
+            _tail = prev;
+        }
+
         static void swap(List<T>& first, List<T>& second) {
             if (first._size != second._size) {
                 return;
@@ -590,5 +965,1052 @@ namespace my_container {
         }
 
     };
+
+    // Развёрнутый список: в узле лежат подряд до B элементов, поэтому проход
+    // переходит по указателю раз в B элементов, а не на каждом. Вставка и
+    // удаление по итератору сдвигают элементы внутри одного узла. Полный узел
+    // при вставке в середину делится пополам, узел, заполненный меньше чем
+    // наполовину, после удаления сливается со следующим, если они помещаются
+    // в один. Вставка и удаление делают недействительными итераторы на
+    // элементы затронутых узлов и end().
+    template<class T, size_t B = std::max<size_t>(8, 256 / sizeof(T))>
+    class UnrolledList : public Container<T> {
+        static_assert(B >= 2, "UnrolledList needs at least two elements per node");
+
+    private:
+        struct Node {
+            Node* next = nullptr;
+            Node* prev = nullptr;
+            size_t count = 0;
+            alignas(T) unsigned char storage[sizeof(T) * B];
+
+            T* data() noexcept { return reinterpret_cast<T*>(storage); }
+        };
+
+        Node* _head = nullptr;
+        Node* _tail = nullptr;
+        size_t _size = 0;
+
+        Node* _new_node(Node* prev, Node* next) {
+            Node* node = new Node;
+            node->prev = prev;
+            node->next = next;
+            ((prev == nullptr) ? _head : prev->next) = node;
+            ((next == nullptr) ? _tail : next->prev) = node;
+            return node;
+        }
+        void _free_node(Node* node) noexcept {
+            ((node->prev == nullptr) ? _head : node->prev->next) = node->next;
+            ((node->next == nullptr) ? _tail : node->next->prev) = node->prev;
+            delete node;
+        }
+        static void _relocate(T* from, size_t count, T* to) {
+            std::uninitialized_move(from, from + count, to);
+            std::destroy(from, from + count);
+        }
+
+    public:
+        // Итератор — узел и позиция в нём; end() указывает за последний
+        // элемент хвостового узла, поэтому от него можно идти назад.
+        template<bool Const>
+        class Iter {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            Node* node = nullptr;
+            size_t index = 0;
+
+            Iter() = default;
+            Iter(Node* node, size_t index) : node(node), index(index) {}
+            template<bool C> requires (Const && !C)
+            Iter(const Iter<C>& other) : node(other.node), index(other.index) {}
+
+            reference operator*() const { return node->data()[index]; }
+            pointer operator->() const { return node->data() + index; }
+            Iter& operator++() {
+                if (++index == node->count && node->next != nullptr) {
+                    node = node->next;
+                    index = 0;
+                }
+                return *this;
+            }
+            Iter operator++(int) {
+                Iter tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            Iter& operator--() {
+                if (index == 0) {
+                    node = node->prev;
+                    index = node->count;
+                }
+                --index;
+                return *this;
+            }
+            Iter operator--(int) {
+                Iter tmp = *this;
+                --*this;
+                return tmp;
+            }
+            bool operator==(const Iter& other) const = default;
+        };
+
+        using iterator = Iter<false>;
+        using const_iterator = Iter<true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        UnrolledList() = default;
+        UnrolledList(const std::initializer_list<T>& initList) {
+            for (const T& element : initList) {
+                push_back(element);
+            }
+        }
+        UnrolledList(const UnrolledList& copy) : Container<T>() {
+            for (const T& element : copy) {
+                push_back(element);
+            }
+        }
+        UnrolledList(UnrolledList&& other) noexcept
+            : Container<T>(), _head(std::exchange(other._head, nullptr)), _tail(std::exchange(other._tail, nullptr)), _size(std::exchange(other._size, 0)) {}
+        UnrolledList& operator=(UnrolledList other) noexcept {
+            std::swap(_head, other._head);
+            std::swap(_tail, other._tail);
+            std::swap(_size, other._size);
+            return *this;
+        }
+        ~UnrolledList() noexcept override final { clear(); }
+
+        iterator begin() noexcept { return iterator(_head, 0); }
+        const_iterator begin() const noexcept { return const_iterator(_head, 0); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        iterator end() noexcept { return (_tail == nullptr) ? iterator() : iterator(_tail, _tail->count); }
+        const_iterator end() const noexcept { return (_tail == nullptr) ? const_iterator() : const_iterator(_tail, _tail->count); }
+        const_iterator cend() const noexcept { return end(); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const noexcept { return rend(); }
+
+        T& front() {
+            if (_size > 0) {
+                return _head->data()[0];
+            }
+            throw std::out_of_range("There are no elements!\n");
+        }
+        T& back() {
+            if (_size > 0) {
+                return _tail->data()[_tail->count - 1];
+            }
+            throw std::out_of_range("There are no elements!\n");
+        }
+        bool empty() const noexcept override final { return _size == 0; }
+        size_t size() const noexcept override final { return _size; }
+        size_t max_size() const noexcept override final { return std::numeric_limits<size_t>::max() / sizeof(T); }
+
+        std::strong_ordering operator<=>(const UnrolledList& other) const {
+            if (_size != other._size) {
+                return _size <=> other._size;
+            }
+            for (auto i = begin(), j = other.begin(); i != end(); ++i, ++j) {
+                if (*i < *j) {
+                    return std::strong_ordering::less;
+                }
+                else if (*j < *i) {
+                    return std::strong_ordering::greater;
+                }
+            }
+            return std::strong_ordering::equal;
+        }
+        bool operator==(const UnrolledList& other) const { return (*this <=> other) == std::strong_ordering::equal; }
+        bool operator!=(const UnrolledList& other) const { return !(*this == other); }
+        bool operator==(const Container<T>& other) const override final {
+            const UnrolledList* list = dynamic_cast<const UnrolledList*>(&other);
+            return list != nullptr && *this == *list;
+        }
+        bool operator!=(const Container<T>& other) const override final { return !(*this == other); }
+
+        void clear() noexcept {
+            Node* cur = _head;
+            while (cur != nullptr) {
+                Node* next = cur->next;
+                std::destroy_n(cur->data(), cur->count);
+                delete cur;
+                cur = next;
+            }
+            _head = nullptr;
+            _tail = nullptr;
+            _size = 0;
+        }
+
+        // Вставка перед position, возвращает итератор на новый элемент.
+        // Вставка на край полного узла начинает новый узел, поэтому при
+        // добавлении в конец или начало узлы заполняются целиком.
+        iterator insert(const_iterator position, const T& element) {
+            T value(element);
+            Node* node = position.node;
+            size_t index = position.index;
+            if (node == nullptr) {
+                node = _new_node(nullptr, nullptr);
+            }
+            else if (node->count == B) {
+                if (index == B) {
+                    node = _new_node(node, node->next);
+                    index = 0;
+                }
+                else if (index == 0) {
+                    node = _new_node(node->prev, node);
+                }
+                else {
+                    Node* right = _new_node(node, node->next);
+                    const size_t half = B / 2;
+                    try {
+                        _relocate(node->data() + half, B - half, right->data());
+                    }
+                    catch (...) {
+                        _free_node(right);
+                        throw;
+                    }
+                    right->count = B - half;
+                    node->count = half;
+                    if (index > half) {
+                        node = right;
+                        index -= half;
+                    }
+                }
+            }
+            T* data = node->data();
+            if (index == node->count) {
+                ::new (data + index) T(std::move(value));
+            }
+            else {
+                ::new (data + node->count) T(std::move(data[node->count - 1]));
+                std::move_backward(data + index, data + node->count - 1, data + node->count);
+                data[index] = std::move(value);
+            }
+            ++node->count;
+            ++_size;
+            return iterator(node, index);
+        }
+        // Удаление, возвращает итератор на следующий элемент.
+        iterator erase(const_iterator position) {
+            Node* node = position.node;
+            size_t index = position.index;
+            T* data = node->data();
+            std::move(data + index + 1, data + node->count, data + index);
+            data[--node->count].~T();
+            --_size;
+            Node* next = node->next;
+            if (node->count == 0) {
+                _free_node(node);
+                return (next == nullptr) ? end() : iterator(next, 0);
+            }
+            if (next != nullptr && node->count < B / 2 && node->count + next->count <= B) {
+                _relocate(next->data(), next->count, data + node->count);
+                node->count += next->count;
+                next->count = 0;
+                _free_node(next);
+            }
+            if (index == node->count && node->next != nullptr) {
+                return iterator(node->next, 0);
+            }
+            return iterator(node, index);
+        }
+        void push_back(const T& element) { insert(cend(), element); }
+        void push_front(const T& element) { insert(cbegin(), element); }
+        void pop_back() {
+            if (_size != 0) {
+                erase(const_iterator(_tail, _tail->count - 1));
+            }
+        }
+        void pop_front() {
+            if (_size != 0) {
+                erase(cbegin());
+            }
+        }
+    };
+
+    template<class T, auto member>
+    class IntrusiveList;
+
+    // Звено интрузивного списка: поле пользовательского типа, в котором
+    // хранятся ссылки на соседей. При копировании объекта звено не
+    // копируется — копия в список не входит. Объект нужно убрать из списка
+    // до разрушения.
+    template<class T>
+    class ListHook {
+    public:
+        ListHook() = default;
+        ListHook(const ListHook&) noexcept {}
+        ListHook& operator=(const ListHook&) noexcept { return *this; }
+        bool is_linked() const noexcept { return _linked; }
+
+    private:
+        template<class U, auto member>
+        friend class IntrusiveList;
+
+        T* _next = nullptr;
+        T* _prev = nullptr;
+        bool _linked = false;
+    };
+
+    // Список чужих объектов: ссылки лежат в звене member самого объекта,
+    // поэтому вставка и удаление не выделяют память и не копируют объект,
+    // а удаление по ссылке на объект — O(1) без поиска. Список объектами не
+    // владеет; объект может одновременно состоять в нескольких списках через
+    // разные звенья.
+    //     struct Timer { ListHook<Timer> hook; ... };
+    //     IntrusiveList<Timer, &Timer::hook> timers;
+    template<class T, auto member>
+    class IntrusiveList {
+        static_assert(std::is_same_v<decltype(member), ListHook<T> T::*>, "IntrusiveList needs a pointer to a ListHook<T> member");
+
+    private:
+        T* _head = nullptr;
+        T* _tail = nullptr;
+        size_t _size = 0;
+
+        static ListHook<T>& _hook(T* node) noexcept { return node->*member; }
+
+        void _link_before(T* node, T* next) noexcept {
+            T* prev = (next == nullptr) ? _tail : _hook(next)._prev;
+            _hook(node)._prev = prev;
+            _hook(node)._next = next;
+            _hook(node)._linked = true;
+            ((prev == nullptr) ? _head : _hook(prev)._next) = node;
+            ((next == nullptr) ? _tail : _hook(next)._prev) = node;
+            ++_size;
+        }
+        void _unlink(T* node) noexcept {
+            ListHook<T>& hook = _hook(node);
+            ((hook._prev == nullptr) ? _head : _hook(hook._prev)._next) = hook._next;
+            ((hook._next == nullptr) ? _tail : _hook(hook._next)._prev) = hook._prev;
+            hook._next = nullptr;
+            hook._prev = nullptr;
+            hook._linked = false;
+            --_size;
+        }
+
+    public:
+        // Итератор хранит указатель на элемент и на список, end() и rend() —
+        // nullptr; обратный итератор идёт по ссылкам prev. От end() назад —
+        // к последнему элементу, от rend() — к первому.
+        template<bool Const, bool Reverse>
+        class Iter {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            T* ptr = nullptr;
+            const IntrusiveList* owner = nullptr;
+
+            Iter() = default;
+            Iter(T* ptr, const IntrusiveList* owner) : ptr(ptr), owner(owner) {}
+            template<bool C> requires (Const && !C)
+            Iter(const Iter<C, Reverse>& other) : ptr(other.ptr), owner(other.owner) {}
+
+            reference operator*() const { return *ptr; }
+            pointer operator->() const { return ptr; }
+            Iter& operator++() {
+                ptr = Reverse ? _hook(ptr)._prev : _hook(ptr)._next;
+                return *this;
+            }
+            Iter operator++(int) {
+                Iter tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            Iter& operator--() {
+                if (ptr == nullptr) {
+                    ptr = Reverse ? owner->_head : owner->_tail;
+                }
+                else {
+                    ptr = Reverse ? _hook(ptr)._next : _hook(ptr)._prev;
+                }
+                return *this;
+            }
+            Iter operator--(int) {
+                Iter tmp = *this;
+                --*this;
+                return tmp;
+            }
+            bool operator==(const Iter& other) const { return ptr == other.ptr; }
+        };
+
+        using iterator = Iter<false, false>;
+        using const_iterator = Iter<true, false>;
+        using reverse_iterator = Iter<false, true>;
+        using const_reverse_iterator = Iter<true, true>;
+
+        IntrusiveList() = default;
+        IntrusiveList(const IntrusiveList&) = delete;
+        IntrusiveList& operator=(const IntrusiveList&) = delete;
+        IntrusiveList(IntrusiveList&& other) noexcept
+            : _head(std::exchange(other._head, nullptr)), _tail(std::exchange(other._tail, nullptr)), _size(std::exchange(other._size, 0)) {}
+        IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+            if (this != &other) {
+                clear();
+                _head = std::exchange(other._head, nullptr);
+                _tail = std::exchange(other._tail, nullptr);
+                _size = std::exchange(other._size, 0);
+            }
+            return *this;
+        }
+        ~IntrusiveList() noexcept { clear(); }
+
+        iterator begin() const noexcept { return iterator(_head, this); }
+        iterator end() const noexcept { return iterator(nullptr, this); }
+        const_iterator cbegin() const noexcept { return const_iterator(_head, this); }
+        const_iterator cend() const noexcept { return const_iterator(nullptr, this); }
+        reverse_iterator rbegin() const noexcept { return reverse_iterator(_tail, this); }
+        reverse_iterator rend() const noexcept { return reverse_iterator(nullptr, this); }
+        const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(_tail, this); }
+        const_reverse_iterator crend() const noexcept { return const_reverse_iterator(nullptr, this); }
+
+        T& front() {
+            if (_size > 0) {
+                return *_head;
+            }
+            throw std::out_of_range("There are no elements!\n");
+        }
+        T& back() {
+            if (_size > 0) {
+                return *_tail;
+            }
+            throw std::out_of_range("There are no elements!\n");
+        }
+        bool empty() const noexcept { return _size == 0; }
+        size_t size() const noexcept { return _size; }
+
+        // Итератор на объект, уже входящий в этот список.
+        iterator iterator_to(T& element) const noexcept { return iterator(&element, this); }
+
+        // Отцепляет все элементы; сами объекты не трогает.
+        void clear() noexcept {
+            while (_head != nullptr) {
+                _unlink(_head);
+            }
+        }
+        // Вставка перед position; объект не должен состоять в списке через
+        // это звено.
+        iterator insert(iterator position, T& element) {
+            if (_hook(&element)._linked) {
+                throw std::invalid_argument("Element is already linked!\n");
+            }
+            _link_before(&element, position.ptr);
+            return iterator(&element, this);
+        }
+        iterator erase(iterator position) noexcept {
+            iterator next(_hook(position.ptr)._next, this);
+            _unlink(position.ptr);
+            return next;
+        }
+        // Удаление объекта, который входит именно в этот список.
+        void remove(T& element) noexcept { _unlink(&element); }
+
+        void push_back(T& element) { insert(end(), element); }
+        void push_front(T& element) { insert(begin(), element); }
+        void pop_back() noexcept {
+            if (_size != 0) {
+                _unlink(_tail);
+            }
+        }
+        void pop_front() noexcept {
+            if (_size != 0) {
+                _unlink(_head);
+            }
+        }
+    };
+
+    // Индексируемый список с пропусками: последовательность, в которой доступ
+    // к k-му элементу, поиск в отсортированной последовательности и вставка и
+    // удаление по итератору занимают в среднем O(log n). Каждый узел имеет
+    // случайную высоту (уровень i+1 есть с вероятностью 1/2 у узла с уровнем
+    // i); ссылка уровня i хранит ширину — сколько шагов нулевого уровня она
+    // перепрыгивает, для последнего узла уровня — до позиции за концом.
+    // Позиция итератора ищется проходом вперёд до конца с подъёмом на более
+    // высокие узлы, тоже в среднем за O(log n).
+    template<class T>
+    class IndexedSkipList : public Container<T> {
+    private:
+        static constexpr unsigned _max_height = 32;
+
+        struct Node;
+        struct Link {
+            Node* next;
+            size_t width;
+        };
+        // Ссылки лежат сразу за узлом, их столько, какова высота узла
+        struct Node {
+            Node* prev;
+            unsigned height;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T& value() noexcept { return *reinterpret_cast<T*>(storage); }
+            Link* links() noexcept { return reinterpret_cast<Link*>(this + 1); }
+        };
+
+        // Голова заводится при первой вставке, поэтому пустой список и
+        // перемещение обходятся без выделения памяти.
+        Node* _head = nullptr;
+        Node* _tail = nullptr;
+        size_t _size = 0;
+        uint64_t _random = 0x9E3779B97F4A7C15ull;
+
+        static Node* _allocate(unsigned height) {
+            Node* node = static_cast<Node*>(::operator new(sizeof(Node) + height * sizeof(Link), std::align_val_t(alignof(Node))));
+            node->prev = nullptr;
+            node->height = height;
+            return node;
+        }
+        // В пустом списке все ссылки головы ведут за конец, на позицию 1
+        void _reset_head() noexcept {
+            for (unsigned i = 0; i < _max_height; i++) {
+                _head->links()[i] = { nullptr, 1 };
+            }
+        }
+        static void _deallocate(Node* node) noexcept { ::operator delete(node, std::align_val_t(alignof(Node))); }
+        Node* _first() const noexcept { return (_head == nullptr) ? nullptr : _head->links()[0].next; }
+
+        unsigned _random_height() noexcept {
+            _random ^= _random << 13;
+            _random ^= _random >> 7;
+            _random ^= _random << 17;
+            return std::min<unsigned>(1 + std::countr_zero(_random | (uint64_t(1) << (_max_height - 1))), _max_height);
+        }
+
+        // Для позиции index находит на каждом уровне последний узел перед
+        // ней (update) и его позицию (rank); у головы позиция 0, у элемента
+        // с индексом k — k + 1.
+        void _find(size_t index, Node** update, size_t* rank) const noexcept {
+            Node* x = _head;
+            size_t pos = 0;
+            for (unsigned i = _max_height; i-- > 0;) {
+                while (x->links()[i].next != nullptr && pos + x->links()[i].width <= index) {
+                    pos += x->links()[i].width;
+                    x = x->links()[i].next;
+                }
+                update[i] = x;
+                rank[i] = pos;
+            }
+        }
+
+        template<class... Args>
+        Node* _insert_at(size_t index, Args&&... args) {
+            if (_head == nullptr) {
+                _head = _allocate(_max_height);
+                _reset_head();
+            }
+            Node* update[_max_height];
+            size_t rank[_max_height];
+            _find(index, update, rank);
+            Node* node = _allocate(_random_height());
+            try {
+                ::new (node->storage) T(std::forward<Args>(args)...);
+            }
+            catch (...) {
+                _deallocate(node);
+                throw;
+            }
+            const size_t pos = index + 1;
+            for (unsigned i = 0; i < _max_height; i++) {
+                Link& link = update[i]->links()[i];
+                if (i < node->height) {
+                    node->links()[i] = { link.next, rank[i] + link.width + 1 - pos };
+                    link = { node, pos - rank[i] };
+                }
+                else {
+                    ++link.width;
+                }
+            }
+            node->prev = (update[0] == _head) ? nullptr : update[0];
+            Node* next = node->links()[0].next;
+            ((next == nullptr) ? _tail : next->prev) = node;
+            ++_size;
+            return node;
+        }
+
+        void _erase_at(size_t index) noexcept {
+            Node* update[_max_height];
+            size_t rank[_max_height];
+            _find(index, update, rank);
+            Node* node = update[0]->links()[0].next;
+            for (unsigned i = 0; i < _max_height; i++) {
+                Link& link = update[i]->links()[i];
+                if (i < node->height) {
+                    link = { node->links()[i].next, link.width + node->links()[i].width - 1 };
+                }
+                else {
+                    --link.width;
+                }
+            }
+            Node* next = node->links()[0].next;
+            ((next == nullptr) ? _tail : next->prev) = node->prev;
+            node->value().~T();
+            _deallocate(node);
+            --_size;
+        }
+
+        // Расстояние от узла до позиции за концом
+        static size_t _distance_to_end(Node* x) noexcept {
+            size_t distance = 0;
+            unsigned i = x->height - 1;
+            while (x != nullptr) {
+                distance += x->links()[i].width;
+                x = x->links()[i].next;
+                if (x != nullptr) {
+                    i = x->height - 1;
+                }
+            }
+            return distance;
+        }
+
+    public:
+        template<bool Const>
+        class Iter {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            Node* ptr = nullptr;
+            const IndexedSkipList* owner = nullptr;
+
+            Iter() = default;
+            Iter(Node* ptr, const IndexedSkipList* owner) : ptr(ptr), owner(owner) {}
+            template<bool C> requires (Const && !C)
+            Iter(const Iter<C>& other) : ptr(other.ptr), owner(other.owner) {}
+
+            reference operator*() const { return ptr->value(); }
+            pointer operator->() const { return &ptr->value(); }
+            Iter& operator++() {
+                ptr = ptr->links()[0].next;
+                return *this;
+            }
+            Iter operator++(int) {
+                Iter tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            // От end() назад — к последнему элементу
+            Iter& operator--() {
+                ptr = (ptr == nullptr) ? owner->_tail : ptr->prev;
+                return *this;
+            }
+            Iter operator--(int) {
+                Iter tmp = *this;
+                --*this;
+                return tmp;
+            }
+            bool operator==(const Iter& other) const { return ptr == other.ptr; }
+        };
+
+        using iterator = Iter<false>;
+        using const_iterator = Iter<true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        IndexedSkipList() noexcept {}
+        IndexedSkipList(const std::initializer_list<T>& initList) : IndexedSkipList() {
+            for (const T& element : initList) {
+                push_back(element);
+            }
+        }
+        IndexedSkipList(const IndexedSkipList& copy) : IndexedSkipList() {
+            for (const T& element : copy) {
+                push_back(element);
+            }
+        }
+        IndexedSkipList(IndexedSkipList&& other) noexcept
+            : _head(std::exchange(other._head, nullptr)), _tail(std::exchange(other._tail, nullptr)), _size(std::exchange(other._size, 0)) {}
+        IndexedSkipList& operator=(IndexedSkipList other) noexcept {
+            swap(other);
+            return *this;
+        }
+        ~IndexedSkipList() noexcept override final {
+            if (_head != nullptr) {
+                clear();
+                _deallocate(_head);
+            }
+        }
+        void swap(IndexedSkipList& other) noexcept {
+            std::swap(_head, other._head);
+            std::swap(_tail, other._tail);
+            std::swap(_size, other._size);
+        }
+
+        iterator begin() noexcept { return iterator(_first(), this); }
+        const_iterator begin() const noexcept { return const_iterator(_first(), this); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        iterator end() noexcept { return iterator(nullptr, this); }
+        const_iterator end() const noexcept { return const_iterator(nullptr, this); }
+        const_iterator cend() const noexcept { return end(); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        T& front() {
+            if (_size > 0) {
+                return _head->links()[0].next->value();
+            }
+            throw std::out_of_range("There are no elements!\n");
+        }
+        T& back() {
+            if (_size > 0) {
+                return _tail->value();
+            }
+            throw std::out_of_range("There are no elements!\n");
+        }
+        bool empty() const noexcept override final { return _size == 0; }
+        size_t size() const noexcept override final { return _size; }
+        size_t max_size() const noexcept override final { return std::numeric_limits<size_t>::max() / (sizeof(Node) + sizeof(Link)); }
+
+        bool operator==(const IndexedSkipList& other) const { return _size == other._size && std::equal(begin(), end(), other.begin()); }
+        bool operator!=(const IndexedSkipList& other) const { return !(*this == other); }
+        bool operator==(const Container<T>& other) const override final {
+            const IndexedSkipList* list = dynamic_cast<const IndexedSkipList*>(&other);
+            return list != nullptr && *this == *list;
+        }
+        bool operator!=(const Container<T>& other) const override final { return !(*this == other); }
+
+        // k-й элемент за O(log n)
+        iterator nth(size_t k) {
+            if (k >= _size) {
+                throw std::out_of_range("Index out of range!\n");
+            }
+            Node* update[_max_height];
+            size_t rank[_max_height];
+            _find(k + 1, update, rank);
+            return iterator(update[0], this);
+        }
+        const_iterator nth(size_t k) const { return const_iterator(const_cast<IndexedSkipList*>(this)->nth(k)); }
+        T& operator[](size_t k) { return *nth(k); }
+        const T& operator[](size_t k) const { return *nth(k); }
+
+        // Индекс элемента, на который указывает итератор; end() даёт size()
+        size_t index_of(const_iterator position) const noexcept {
+            return (position.ptr == nullptr) ? _size : _size - _distance_to_end(position.ptr);
+        }
+
+        // Первый элемент, не меньший value, в отсортированной по comp
+        // последовательности
+        template<class Compare = std::less<>>
+        iterator lower_bound(const T& value, Compare comp = Compare{}) {
+            if (_head == nullptr) {
+                return end();
+            }
+            Node* x = _head;
+            for (unsigned i = _max_height; i-- > 0;) {
+                while (x->links()[i].next != nullptr && comp(x->links()[i].next->value(), value)) {
+                    x = x->links()[i].next;
+                }
+            }
+            return iterator(x->links()[0].next, this);
+        }
+
+        void clear() noexcept {
+            if (_head == nullptr) {
+                return;
+            }
+            Node* cur = _head->links()[0].next;
+            while (cur != nullptr) {
+                Node* next = cur->links()[0].next;
+                cur->value().~T();
+                _deallocate(cur);
+                cur = next;
+            }
+            _reset_head();
+            _tail = nullptr;
+            _size = 0;
+        }
+
+        // Вставка перед position, возвращает итератор на новый элемент
+        template<class... Args>
+        iterator emplace(const_iterator position, Args&&... args) {
+            return iterator(_insert_at(index_of(position), std::forward<Args>(args)...), this);
+        }
+        iterator insert(const_iterator position, const T& element) { return emplace(position, element); }
+        iterator insert(const_iterator position, T&& element) { return emplace(position, std::move(element)); }
+        // Вставка в отсортированную последовательность с сохранением порядка
+        template<class Compare = std::less<>>
+        iterator insert_sorted(const T& element, Compare comp = Compare{}) { return insert(lower_bound(element, comp), element); }
+        // Удаление, возвращает итератор на следующий элемент
+        iterator erase(const_iterator position) noexcept {
+            Node* next = position.ptr->links()[0].next;
+            _erase_at(index_of(position));
+            return iterator(next, this);
+        }
+
+        void push_back(const T& element) { _insert_at(_size, element); }
+        void push_front(const T& element) { _insert_at(0, element); }
+        void pop_back() noexcept {
+            if (_size != 0) {
+                _erase_at(_size - 1);
+            }
+        }
+        void pop_front() noexcept {
+            if (_size != 0) {
+                _erase_at(0);
+            }
+        }
+    };
+
+    namespace detail {
+
+        // Указатели опасности (hazard pointers): поток, который читает узел
+        // lock-free структуры, публикует указатель на него в своей записи, а
+        // удалённые узлы освобождаются только после того, как ни одна запись
+        // на них не указывает. Записи общие на весь процесс: поток занимает
+        // запись при первом обращении и отдаёт её при завершении.
+        inline constexpr size_t hazard_slots = 2;
+        inline constexpr size_t hazard_records_max = 128;
+
+        struct alignas(64) HazardRecord {
+            std::atomic<const void*> pointer[hazard_slots];
+            std::atomic<bool> owned;
+        };
+        inline HazardRecord hazard_records[hazard_records_max];
+
+        struct Retired {
+            void* ptr;
+            void (*deleter)(void*);
+        };
+
+        // Узлы, которые ещё были защищены, когда удаливший их поток
+        // завершился. Их подбирает следующий просмотр любого потока, а
+        // оставшиеся освобождаются при завершении программы.
+        struct RetiredOrphans {
+            std::mutex mutex;
+            std::vector<Retired> nodes;
+            ~RetiredOrphans() {
+                for (Retired& node : nodes) {
+                    node.deleter(node.ptr);
+                }
+            }
+        };
+        inline RetiredOrphans retired_orphans;
+
+        class HazardThread {
+        private:
+            HazardRecord* _record = nullptr;
+            std::vector<Retired> _retired;
+
+            void _scan() {
+                {
+                    std::unique_lock lock(retired_orphans.mutex, std::try_to_lock);
+                    if (lock.owns_lock() && !retired_orphans.nodes.empty()) {
+                        _retired.insert(_retired.end(), retired_orphans.nodes.begin(), retired_orphans.nodes.end());
+                        retired_orphans.nodes.clear();
+                    }
+                }
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::vector<const void*> hazards;
+                hazards.reserve(hazard_records_max * hazard_slots);
+                for (HazardRecord& record : hazard_records) {
+                    for (auto& pointer : record.pointer) {
+                        const void* ptr = pointer.load(std::memory_order_acquire);
+                        if (ptr != nullptr) {
+                            hazards.push_back(ptr);
+                        }
+                    }
+                }
+                std::sort(hazards.begin(), hazards.end());
+                size_t kept = 0;
+                for (Retired& node : _retired) {
+                    if (std::binary_search(hazards.begin(), hazards.end(), node.ptr)) {
+                        _retired[kept++] = node;
+                    }
+                    else {
+                        node.deleter(node.ptr);
+                    }
+                }
+                _retired.resize(kept);
+            }
+
+        public:
+            HazardThread() {
+                for (HazardRecord& record : hazard_records) {
+                    if (!record.owned.load(std::memory_order_relaxed) && !record.owned.exchange(true, std::memory_order_acquire)) {
+                        _record = &record;
+                        return;
+                    }
+                }
+                throw std::runtime_error("Too many threads use hazard pointers!\n");
+            }
+            HazardThread(const HazardThread&) = delete;
+            HazardThread& operator=(const HazardThread&) = delete;
+            ~HazardThread() {
+                clear();
+                _scan();
+                if (!_retired.empty()) {
+                    std::lock_guard lock(retired_orphans.mutex);
+                    retired_orphans.nodes.insert(retired_orphans.nodes.end(), _retired.begin(), _retired.end());
+                }
+                _record->owned.store(false, std::memory_order_release);
+            }
+
+            // Публикует текущее значение source в слоте slot и возвращает его,
+            // когда оно гарантированно ещё не удалено.
+            template<class N>
+            N* protect(size_t slot, const std::atomic<N*>& source) noexcept {
+                N* ptr = source.load(std::memory_order_relaxed);
+                while (true) {
+                    _record->pointer[slot].store(ptr, std::memory_order_seq_cst);
+                    N* again = source.load(std::memory_order_acquire);
+                    if (again == ptr) {
+                        return ptr;
+                    }
+                    ptr = again;
+                }
+            }
+            void set(size_t slot, const void* ptr) noexcept { _record->pointer[slot].store(ptr, std::memory_order_seq_cst); }
+            void clear() noexcept {
+                for (auto& pointer : _record->pointer) {
+                    pointer.store(nullptr, std::memory_order_release);
+                }
+            }
+            // Узел освобождается при одном из следующих просмотров; просмотр
+            // запускается раз в несколько сотен удалений, так что в среднем
+            // удаление стоит O(1).
+            template<class N>
+            void retire(N* node) {
+                _retired.push_back({ node, [](void* ptr) { delete static_cast<N*>(ptr); } });
+                if (_retired.size() >= 2 * hazard_records_max * hazard_slots) {
+                    _scan();
+                }
+            }
+        };
+
+        inline HazardThread& hazard_thread() {
+            thread_local HazardThread thread;
+            return thread;
+        }
+    }
+
+    // Очередь Майкла–Скотта: lock-free очередь для любого числа
+    // производителей и потребителей. Голова всегда указывает на фиктивный
+    // узел, значение лежит в следующем за ним. Снятые узлы освобождаются
+    // через указатели опасности, поэтому поток, который ещё читает узел, не
+    // наткнётся на освобождённую память. Одновременно очередями могут
+    // пользоваться не больше detail::hazard_records_max потоков. Перемещение
+    // T не должно бросать исключений.
+    template<class T>
+    class ConcurrentQueue {
+    private:
+        struct Node {
+            std::atomic<Node*> next = nullptr;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T* value() noexcept { return reinterpret_cast<T*>(storage); }
+        };
+
+        alignas(64) std::atomic<Node*> _head;
+        alignas(64) std::atomic<Node*> _tail;
+
+    public:
+        ConcurrentQueue() {
+            Node* dummy = new Node;
+            _head.store(dummy, std::memory_order_relaxed);
+            _tail.store(dummy, std::memory_order_relaxed);
+        }
+        ConcurrentQueue(const ConcurrentQueue&) = delete;
+        ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+        // Разрушать очередь можно только когда ею никто не пользуется.
+        ~ConcurrentQueue() {
+            Node* node = _head.load(std::memory_order_relaxed);
+            Node* next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            while (next != nullptr) {
+                node = next;
+                next = node->next.load(std::memory_order_relaxed);
+                node->value()->~T();
+                delete node;
+            }
+        }
+
+        template<class... Args>
+        void emplace_back(Args&&... args) {
+            Node* node = new Node;
+            try {
+                ::new (node->storage) T(std::forward<Args>(args)...);
+            }
+            catch (...) {
+                delete node;
+                throw;
+            }
+            detail::HazardThread& hazard = detail::hazard_thread();
+            while (true) {
+                Node* tail = hazard.protect(0, _tail);
+                Node* next = tail->next.load(std::memory_order_acquire);
+                if (tail != _tail.load(std::memory_order_acquire)) {
+                    continue;
+                }
+                if (next != nullptr) {
+                    // Хвост отстал — помогаем его передвинуть
+                    _tail.compare_exchange_weak(tail, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+                    continue;
+                }
+                if (tail->next.compare_exchange_weak(next, node, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    _tail.compare_exchange_strong(tail, node, std::memory_order_acq_rel, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            hazard.clear();
+        }
+        void push_back(const T& element) { emplace_back(element); }
+        void push_back(T&& element) { emplace_back(std::move(element)); }
+
+        std::optional<T> try_pop_front() {
+            detail::HazardThread& hazard = detail::hazard_thread();
+            while (true) {
+                Node* head = hazard.protect(0, _head);
+                Node* tail = _tail.load(std::memory_order_acquire);
+                Node* next = head->next.load(std::memory_order_acquire);
+                hazard.set(1, next);
+                if (head != _head.load(std::memory_order_acquire)) {
+                    continue;
+                }
+                if (next == nullptr) {
+                    hazard.clear();
+                    return std::nullopt;
+                }
+                if (head == tail) {
+                    _tail.compare_exchange_weak(tail, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+                    continue;
+                }
+                if (_head.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    // next стал фиктивным узлом, но значение в нём принадлежит
+                    // нам, а сам узел защищён слотом 1
+                    std::optional<T> result(std::move(*next->value()));
+                    next->value()->~T();
+                    hazard.clear();
+                    hazard.retire(head);
+                    return result;
+                }
+            }
+        }
+
+        // При одновременных вставках и удалениях результат может устареть
+        // сразу после возврата.
+        bool empty() const {
+            detail::HazardThread& hazard = detail::hazard_thread();
+            Node* head = hazard.protect(0, _head);
+            bool result = head->next.load(std::memory_order_acquire) == nullptr;
+            hazard.clear();
+            return result;
+        }
+    };
 }
-#endif
\ No newline at end of file
+#endif
@@ -1,9 +1,24 @@
 #include <gtest/gtest.h>
 #include "my_lib.hpp"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace my_container;
 using namespace std;
 
+static size_t heap_allocations = 0;
+
+void* operator new(size_t n) {
+    heap_allocations++;
+    if (void* p = malloc(n ? n : 1))
+        return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
 TEST(ListTest, DefaultConstructor) {
     List<int> list;
     EXPECT_EQ(list.size(), 0);
@@ -178,6 +193,867 @@ TEST(ListTest, EdgeCases) {
     EXPECT_TRUE(singleElement.empty());
 }
 
+TEST(ListTest, InsertEraseAtEnds) {
+    List<int> list = { 2, 3 };
+    list.insert(list.begin(), 1);
+    list.insert(list.end(), 4);
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 4);
+
+    list.erase(list.begin());
+    auto last = list.begin();
+    ++last;
+    ++last;
+    list.erase(last);
+    EXPECT_EQ(list, (List<int>{ 2, 3 }));
+    EXPECT_EQ(*list.rbegin(), 3);
+
+    list.pop_back();
+    list.pop_back();
+    list.pop_back();
+    EXPECT_TRUE(list.empty());
+    list.push_front(7);
+    EXPECT_EQ(list.front(), 7);
+    EXPECT_EQ(list.back(), 7);
+}
+
+TEST(ListTest, PoolReusesNodes) {
+    List<int> list;
+    for (int i = 0; i < 32; i++) {
+        list.push_back(i);
+    }
+    auto pool = list.pool();
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(pool->chunks(), 1);
+
+    // Освобождённые узлы возвращаются в пул и выдаются снова
+    for (int round = 0; round < 100; round++) {
+        list.pop_front();
+        list.push_back(round);
+    }
+    EXPECT_EQ(pool->chunks(), 1);
+    EXPECT_EQ(list.size(), 32);
+    EXPECT_EQ(list.back(), 99);
+}
+
+TEST(ListTest, SharedPool) {
+    auto pool = std::make_shared<List<int>::pool_type>(4, 16);
+    List<int> a(pool);
+    List<int> b({ 1, 2, 3 }, pool);
+    a.push_back(10);
+    EXPECT_EQ(a.pool(), pool);
+    EXPECT_EQ(b.pool(), pool);
+    EXPECT_EQ(pool->chunks(), 1);
+
+    List<int> c(b, pool);
+    EXPECT_EQ(c.pool(), pool);
+    EXPECT_EQ(c, b);
+    EXPECT_EQ(pool->chunks(), 2);
+
+    b.clear();
+    for (int i = 0; i < 3; i++) {
+        a.push_back(i);
+    }
+    EXPECT_EQ(pool->chunks(), 2);
+}
+
+TEST(ListTest, CopyOwnPool) {
+    auto pool = std::make_shared<List<int>::pool_type>();
+    List<int> a({ 1, 2, 3 }, pool);
+
+    // Копия не делит пул с оригиналом
+    List<int> b(a);
+    EXPECT_EQ(b, a);
+    ASSERT_NE(b.pool(), nullptr);
+    EXPECT_NE(b.pool(), pool);
+    EXPECT_EQ(pool.use_count(), 2);
+
+    List<int> c;
+    c = a;
+    EXPECT_EQ(c, a);
+    EXPECT_NE(c.pool(), pool);
+
+    const List<int> empty(pool);
+    List<int> d(empty);
+    EXPECT_EQ(d.pool(), nullptr);
+}
+
+struct NoDefault {
+    int value;
+    explicit NoDefault(int v) : value(v) {}
+    auto operator<=>(const NoDefault&) const = default;
+};
+
+TEST(ListTest, NoDefaultConstructor) {
+    List<NoDefault> list;
+    list.push_back(NoDefault(1));
+    list.push_front(NoDefault(0));
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list.front().value, 0);
+    EXPECT_EQ(list.back().value, 1);
+}
+
+TEST(ListTest, SpliceSharedPool) {
+    auto pool = std::make_shared<List<int>::pool_type>();
+    List<int> a({ 1, 5 }, pool);
+    List<int> b({ 2, 3, 4 }, pool);
+    int* two = &b.front();
+
+    auto pos = a.begin();
+    ++pos;
+    a.splice(pos, b);
+    EXPECT_EQ(a, (List<int>{ 1, 2, 3, 4, 5 }));
+    EXPECT_TRUE(b.empty());
+    // Узлы перецеплены, а не скопированы
+    EXPECT_EQ(&*(++a.begin()), two);
+
+    b.splice(b.end(), a, a.begin());
+    b.splice(b.begin(), a, pos, a.end());
+    EXPECT_EQ(a, (List<int>{ 2, 3, 4 }));
+    EXPECT_EQ(b, (List<int>{ 5, 1 }));
+    EXPECT_EQ(a.size(), 3);
+    EXPECT_EQ(b.size(), 2);
+    EXPECT_EQ(*b.rbegin(), 1);
+
+    // Перенос внутри одного списка
+    a.splice(a.begin(), a, ++a.begin(), a.end());
+    EXPECT_EQ(a, (List<int>{ 3, 4, 2 }));
+    EXPECT_EQ(a.back(), 2);
+    EXPECT_EQ(*(++a.rbegin()), 4);
+}
+
+TEST(ListTest, SpliceAcrossPools) {
+    List<int> a = { 1, 2 };
+    List<int> b = { 3, 4 };
+    int* three = &b.front();
+    a.splice(a.end(), b);
+    EXPECT_EQ(a, (List<int>{ 1, 2, 3, 4 }));
+    EXPECT_TRUE(b.empty());
+    // Пул b влился в пул a, узлы перецеплены
+    EXPECT_EQ(a.pool(), b.pool());
+    EXPECT_EQ(&*(++(++a.begin())), three);
+
+    // Пустой список без пула перенимает пул другого
+    List<int> c;
+    c.splice(c.begin(), a, a.begin());
+    EXPECT_EQ(c.pool(), a.pool());
+    EXPECT_EQ(c.front(), 1);
+    EXPECT_EQ(a.size(), 3);
+
+    // Диапазон и одиночный узел из списка со своим пулом
+    List<int> d = { 10, 11, 12, 13 };
+    int* eleven = &*(++d.begin());
+    int* thirteen = &d.back();
+    auto last = d.begin();
+    std::advance(last, 3);
+    a.splice(a.begin(), d, ++d.begin(), last);
+    a.splice(a.end(), d, last);
+    EXPECT_EQ(a, (List<int>{ 11, 12, 2, 3, 4, 13 }));
+    EXPECT_EQ(d, (List<int>{ 10 }));
+    EXPECT_EQ(&a.front(), eleven);
+    EXPECT_EQ(&a.back(), thirteen);
+    EXPECT_EQ(d.pool(), a.pool());
+
+    // Освобождённые узлы обоих пулов выдаются повторно
+    auto pool = a.pool();
+    size_t chunks = pool->chunks();
+    a.clear();
+    c.clear();
+    for (int i = 0; i < 64; i++) {
+        a.push_back(i);
+    }
+    EXPECT_EQ(pool->chunks(), chunks);
+    EXPECT_EQ(d.front(), 10);
+}
+
+TEST(ListTest, SpliceOntoItself) {
+    List<int> a = { 1, 2, 3 };
+    auto it = ++a.begin();
+    int* two = &*it;
+
+    // Элемент и диапазон переносятся на своё же место
+    a.splice(it, a, it);
+    a.splice(a.end(), a, it, a.end());
+    a.splice(it, a, a.begin(), it);
+    a.splice(a.begin(), a, a.begin(), a.end());
+    EXPECT_EQ(a, (List<int>{ 1, 2, 3 }));
+    EXPECT_EQ(a.size(), 3);
+    EXPECT_EQ(&*(++a.begin()), two);
+    EXPECT_EQ(a.back(), 3);
+    EXPECT_EQ(*(++a.rbegin()), 2);
+
+    // Перед следующим за ним элементом — тоже на месте
+    auto next = it;
+    ++next;
+    a.splice(next, a, it);
+    EXPECT_EQ(a, (List<int>{ 1, 2, 3 }));
+}
+
+TEST(ListTest, SpliceThirdPartyPools) {
+    // Оба пула разделены с третьими списками: элементы перемещаются
+    auto pool1 = std::make_shared<List<std::unique_ptr<int>>::pool_type>();
+    auto pool2 = std::make_shared<List<std::unique_ptr<int>>::pool_type>();
+    List<std::unique_ptr<int>> a(pool1);
+    List<std::unique_ptr<int>> b(pool2);
+    List<std::unique_ptr<int>> keep1(pool1);
+    List<std::unique_ptr<int>> keep2(pool2);
+    a.push_back(std::make_unique<int>(1));
+    b.push_back(std::make_unique<int>(2));
+    b.push_back(std::make_unique<int>(3));
+    int* two = b.front().get();
+
+    a.splice(a.end(), b);
+    EXPECT_TRUE(b.empty());
+    ASSERT_EQ(a.size(), 3);
+    EXPECT_EQ(a.pool(), pool1);
+    EXPECT_EQ(b.pool(), pool2);
+    EXPECT_EQ((*(++a.begin())).get(), two);
+    EXPECT_EQ(*a.back(), 3);
+}
+
+TEST(ListTest, SpliceUniquePtr) {
+    List<std::unique_ptr<int>> a;
+    List<std::unique_ptr<int>> b;
+    a.push_back(std::make_unique<int>(1));
+    b.push_back(std::make_unique<int>(2));
+    auto* node = &b.front();
+
+    a.splice(a.begin(), b, b.begin());
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(&a.front(), node);
+    EXPECT_EQ(*a.front(), 2);
+    EXPECT_EQ(*a.back(), 1);
+}
+
+TEST(ListTest, Merge) {
+    auto pool = std::make_shared<List<int>::pool_type>();
+    List<int> a({ 1, 3, 5, 7 }, pool);
+    List<int> b({ 0, 2, 3, 8, 9 }, pool);
+    a.merge(b);
+    EXPECT_EQ(a, (List<int>{ 0, 1, 2, 3, 3, 5, 7, 8, 9 }));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.back(), 9);
+
+    List<int> c = { 6, 4 };
+    List<int> d = { 5 };
+    c.merge(d, std::greater<>());
+    EXPECT_EQ(c, (List<int>{ 6, 5, 4 }));
+}
+
+TEST(ListTest, MergeAcrossPools) {
+    List<int> a = { 1, 4, 6 };
+    List<int> b = { 2, 3, 5, 7 };
+    std::vector<const int*> nodes;
+    for (const int& x : b) {
+        nodes.push_back(&x);
+    }
+    a.merge(b);
+    EXPECT_EQ(a, (List<int>{ 1, 2, 3, 4, 5, 6, 7 }));
+    EXPECT_TRUE(b.empty());
+    // Узлы b перешли в a без копирования
+    EXPECT_EQ(&*(++a.begin()), nodes[0]);
+    EXPECT_EQ(&*(++(++a.begin())), nodes[1]);
+    EXPECT_EQ(&a.back(), nodes[3]);
+}
+
+TEST(ListTest, Sort) {
+    List<int> empty;
+    empty.sort();
+    EXPECT_TRUE(empty.empty());
+
+    List<int> list;
+    for (int i = 0; i < 1000; i++) {
+        list.push_back((i * 7919) % 1000);
+    }
+    int* first = &list.front();
+    list.sort();
+    int expected = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(list.size(), 1000);
+    EXPECT_EQ(list.back(), 999);
+    EXPECT_EQ(*(++list.rbegin()), 998);
+    // Элементы не перемещались
+    EXPECT_EQ(*first, 0);
+
+    list.sort(std::greater<>());
+    EXPECT_EQ(list.front(), 999);
+    EXPECT_EQ(list.back(), 0);
+}
+
+TEST(ListTest, SortIsStable) {
+    List<std::pair<int, int>> list;
+    for (int i = 0; i < 100; i++) {
+        list.push_back({ i % 3, i });
+    }
+    list.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+    auto prev = list.front();
+    for (auto it = ++list.begin(); it != list.end(); ++it) {
+        EXPECT_LE(prev.first, (*it).first);
+        if (prev.first == (*it).first) {
+            EXPECT_LT(prev.second, (*it).second);
+        }
+        prev = *it;
+    }
+}
+
+static_assert(std::bidirectional_iterator<UnrolledList<int>::iterator>);
+static_assert(std::bidirectional_iterator<UnrolledList<int>::const_iterator>);
+
+// Маленький узел, чтобы деление и слияние узлов срабатывали часто
+using SmallUnrolled = UnrolledList<int, 4>;
+
+template <class L>
+std::vector<int> to_vector(const L& list) {
+    return std::vector<int>(list.begin(), list.end());
+}
+
+List<std::string> make_words(size_t n) {
+    List<std::string> words;
+    for (size_t i = 0; i < n; i++) {
+        words.push_back(std::string(32, char('a' + i % 26)));
+    }
+    return words;
+}
+
+TEST(ListTest, MoveSteals) {
+    List<std::string> source = make_words(100);
+    std::string* first = &source.front();
+
+    size_t before = heap_allocations;
+    List<std::string> moved(std::move(source));
+    EXPECT_EQ(heap_allocations, before);
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(moved.size(), 100);
+    EXPECT_EQ(&moved.front(), first);
+
+    List<std::string> target = { "x" };
+    before = heap_allocations;
+    target = std::move(moved);
+    EXPECT_EQ(heap_allocations, before);
+    EXPECT_EQ(&target.front(), first);
+    EXPECT_EQ(target.size(), 100);
+    EXPECT_TRUE(moved.empty());
+
+    // Перемещённый список снова пригоден к использованию
+    moved.push_back("again");
+    EXPECT_EQ(moved.front(), "again");
+}
+
+TEST(ListTest, CopyAssignmentReusesNodes) {
+    List<std::string> source = make_words(100);
+    List<std::string> target = make_words(100);
+    std::string* first = &target.front();
+    std::string* last = &target.back();
+
+    // Строки той же длины помещаются в старые буферы — ни одного выделения
+    size_t before = heap_allocations;
+    target = source;
+    EXPECT_EQ(heap_allocations, before);
+    EXPECT_EQ(target, source);
+    EXPECT_EQ(&target.front(), first);
+    EXPECT_EQ(&target.back(), last);
+
+    List<std::string> shorter = make_words(10);
+    target = shorter;
+    EXPECT_EQ(target.size(), 10);
+    EXPECT_EQ(&target.front(), first);
+    target = source;
+    EXPECT_EQ(target, source);
+
+    target = target;
+    EXPECT_EQ(target, source);
+}
+
+TEST(ListTest, Emplace) {
+    List<std::pair<int, std::string>> list;
+    list.emplace_back(2, "two");
+    list.emplace_front(1, "one");
+    auto it = list.emplace(list.end(), 4, "four");
+    list.emplace(it, 3, "three");
+    auto& ref = list.emplace_back(5, "five");
+    EXPECT_EQ(&ref, &list.back());
+    int expected = 1;
+    for (auto i = list.begin(); i != list.end(); ++i) {
+        EXPECT_EQ((*i).first, expected++);
+    }
+
+    List<std::unique_ptr<int>> owners;
+    owners.push_back(std::make_unique<int>(7));
+    owners.emplace_front(new int(6));
+    EXPECT_EQ(*owners.front(), 6);
+    EXPECT_EQ(*owners.back(), 7);
+}
+
+static_assert(std::bidirectional_iterator<List<int>::iterator>);
+static_assert(std::bidirectional_iterator<List<int>::const_iterator>);
+
+TEST(ListTest, RangeConstructors) {
+    std::vector<int> values(10000);
+    for (int i = 0; i < 10000; i++) {
+        values[i] = i;
+    }
+    List<int> list(values.begin(), values.end());
+    EXPECT_EQ(list.size(), 10000);
+    EXPECT_EQ(list.back(), 9999);
+    // Место под все узлы взято одним куском
+    EXPECT_EQ(list.pool()->chunks(), 1);
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), values);
+
+    List<std::string> filled(3, "ab");
+    EXPECT_EQ(filled, (List<std::string>{ "ab", "ab", "ab" }));
+    List<int> counted(size_t(4), 7);
+    EXPECT_EQ(counted, (List<int>{ 7, 7, 7, 7 }));
+}
+
+TEST(ListTest, Assign) {
+    List<std::string> list = { "a", "b", "c" };
+    std::string* first = &list.front();
+    list.assign(5, "x");
+    EXPECT_EQ(list, (List<std::string>{ "x", "x", "x", "x", "x" }));
+    EXPECT_EQ(&list.front(), first);
+    list.assign(2, "y");
+    EXPECT_EQ(list, (List<std::string>{ "y", "y" }));
+
+    std::vector<std::string> words = { "p", "q", "r" };
+    list.assign(words.begin(), words.end());
+    EXPECT_EQ(list, (List<std::string>{ "p", "q", "r" }));
+    EXPECT_EQ(&list.front(), first);
+    list.assign(words.begin(), words.begin() + 1);
+    EXPECT_EQ(list, (List<std::string>{ "p" }));
+}
+
+TEST(ListTest, BulkClear) {
+    // Собственный пул освобождается целиком, строки при этом разрушаются
+    List<std::string> strings(1000, std::string(40, 's'));
+    strings.clear();
+    EXPECT_TRUE(strings.empty());
+    strings.push_back("again");
+    EXPECT_EQ(strings.front(), "again");
+
+    List<int> ints(1000, 1);
+    ints.clear();
+    ints.push_back(2);
+    EXPECT_EQ(ints.size(), 1);
+
+    // С общим пулом узлы возвращаются в пул и достаются другому списку
+    auto pool = std::make_shared<List<int>::pool_type>();
+    List<int> a(size_t(100), 1, pool);
+    List<int> b(pool);
+    size_t chunks = pool->chunks();
+    a.clear();
+    b.resize(100, 2);
+    EXPECT_EQ(pool->chunks(), chunks);
+    EXPECT_EQ(b.size(), 100);
+}
+
+TEST(UnrolledListTest, PushPop) {
+    SmallUnrolled list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.front(), std::out_of_range);
+    for (int i = 0; i < 10; i++) {
+        list.push_back(i);
+    }
+    list.push_front(-1);
+    EXPECT_EQ(list.size(), 11);
+    EXPECT_EQ(list.front(), -1);
+    EXPECT_EQ(list.back(), 9);
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(to_vector(list), (std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 8 }));
+    while (!list.empty()) {
+        list.pop_back();
+    }
+    list.pop_back();
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(UnrolledListTest, Iterators) {
+    UnrolledList<int, 3> list = { 1, 2, 3, 4, 5, 6, 7 };
+    std::vector<int> reversed(list.rbegin(), list.rend());
+    EXPECT_EQ(reversed, (std::vector<int>{ 7, 6, 5, 4, 3, 2, 1 }));
+
+    auto it = list.end();
+    --it;
+    EXPECT_EQ(*it, 7);
+    it--;
+    --it;
+    EXPECT_EQ(*it, 5);
+    *it = 50;
+    UnrolledList<int, 3>::const_iterator cit = it;
+    EXPECT_EQ(*cit, 50);
+    EXPECT_EQ(std::count(list.cbegin(), list.cend(), 50), 1);
+}
+
+TEST(UnrolledListTest, InsertEraseMatchesVector) {
+    SmallUnrolled list;
+    std::vector<int> model;
+    unsigned seed = 1;
+    for (int step = 0; step < 2000; step++) {
+        seed = seed * 1103515245 + 12345;
+        size_t pos = model.empty() ? 0 : (seed >> 8) % (model.size() + 1);
+        auto it = list.begin();
+        std::advance(it, pos);
+        if (model.size() < 50 && (seed & 3) != 0) {
+            auto inserted = list.insert(it, step);
+            model.insert(model.begin() + pos, step);
+            EXPECT_EQ(*inserted, step);
+        }
+        else if (pos < model.size()) {
+            auto next = list.erase(it);
+            model.erase(model.begin() + pos);
+            if (pos < model.size()) {
+                EXPECT_EQ(*next, model[pos]);
+            }
+            else {
+                EXPECT_EQ(next, list.end());
+            }
+        }
+        ASSERT_EQ(list.size(), model.size());
+    }
+    EXPECT_EQ(to_vector(list), model);
+}
+
+TEST(UnrolledListTest, CopyAndCompare) {
+    UnrolledList<std::string, 2> a = { "a", "b", "c" };
+    UnrolledList<std::string, 2> b(a);
+    EXPECT_EQ(a, b);
+    b.push_back("d");
+    EXPECT_NE(a, b);
+    EXPECT_LT(a, b);
+    a = b;
+    EXPECT_EQ(a, b);
+    UnrolledList<std::string, 2> c(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(c.back(), "d");
+    const Container<std::string>& base = c;
+    EXPECT_TRUE(base == b);
+    List<std::string> list = { "a", "b", "c", "d" };
+    EXPECT_FALSE(base == list);
+}
+
+static_assert(std::bidirectional_iterator<IndexedSkipList<int>::iterator>);
+
+TEST(IndexedSkipListTest, PositionalAccess) {
+    IndexedSkipList<int> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.nth(0), std::out_of_range);
+    for (int i = 0; i < 1000; i++) {
+        list.push_back(i);
+    }
+    list.push_front(-1);
+    EXPECT_EQ(list.size(), 1001);
+    for (size_t k = 0; k < list.size(); k += 37) {
+        EXPECT_EQ(list[k], int(k) - 1);
+        EXPECT_EQ(list.index_of(list.nth(k)), k);
+    }
+    EXPECT_EQ(list.index_of(list.end()), list.size());
+    EXPECT_EQ(list.front(), -1);
+    EXPECT_EQ(list.back(), 999);
+    EXPECT_EQ(*list.rbegin(), 999);
+    EXPECT_EQ(*--list.end(), 999);
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 998);
+    EXPECT_THROW(list.nth(999), std::out_of_range);
+}
+
+TEST(IndexedSkipListTest, InsertEraseMatchesVector) {
+    IndexedSkipList<int> list;
+    std::vector<int> model;
+    unsigned seed = 7;
+    for (int step = 0; step < 3000; step++) {
+        seed = seed * 1103515245 + 12345;
+        size_t pos = (seed >> 8) % (model.size() + 1);
+        if (model.size() < 200 && (seed & 3) != 0) {
+            auto it = (pos == model.size()) ? list.end() : list.nth(pos);
+            auto inserted = list.insert(it, step);
+            model.insert(model.begin() + pos, step);
+            EXPECT_EQ(*inserted, step);
+            EXPECT_EQ(list.index_of(inserted), pos);
+        }
+        else if (pos < model.size()) {
+            auto next = list.erase(list.nth(pos));
+            model.erase(model.begin() + pos);
+            EXPECT_EQ(list.index_of(next), pos);
+        }
+        ASSERT_EQ(list.size(), model.size());
+    }
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), model);
+    EXPECT_EQ(std::vector<int>(list.rbegin(), list.rend()), std::vector<int>(model.rbegin(), model.rend()));
+    for (size_t k = 0; k < model.size(); k++) {
+        ASSERT_EQ(list[k], model[k]);
+    }
+}
+
+TEST(IndexedSkipListTest, SortedAccess) {
+    IndexedSkipList<int> list;
+    for (int i = 0; i < 500; i++) {
+        list.insert_sorted((i * 7919) % 500 * 2);
+    }
+    for (int k = 0; k < 500; k++) {
+        EXPECT_EQ(list[k], 2 * k);
+    }
+    EXPECT_EQ(*list.lower_bound(10), 10);
+    EXPECT_EQ(*list.lower_bound(11), 12);
+    EXPECT_EQ(list.index_of(list.lower_bound(11)), 6);
+    EXPECT_EQ(list.lower_bound(1000), list.end());
+    EXPECT_EQ(list.lower_bound(-5), list.begin());
+
+    IndexedSkipList<std::string> words = { "d", "c", "a" };
+    EXPECT_EQ(*words.lower_bound("b", std::greater<>()), "a");
+}
+
+TEST(IndexedSkipListTest, CopyAndMove) {
+    IndexedSkipList<std::string> a = { "x", "y", "z" };
+    IndexedSkipList<std::string> b(a);
+    EXPECT_EQ(a, b);
+    b[1] = "w";
+    EXPECT_NE(a, b);
+    IndexedSkipList<std::string> c(std::move(b));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(c[1], "w");
+    a = c;
+    EXPECT_EQ(a, c);
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    a.push_back("again");
+    EXPECT_EQ(a[0], "again");
+}
+
+TEST(IndexedSkipListTest, MoveWithoutAllocation) {
+    static_assert(std::is_nothrow_move_constructible_v<IndexedSkipList<std::string>>);
+    // Пустой и перемещённый списки работают без головы
+    IndexedSkipList<int> a;
+    EXPECT_EQ(a.begin(), a.end());
+    EXPECT_EQ(a.lower_bound(5), a.end());
+    EXPECT_EQ(a.index_of(a.end()), 0);
+    a.clear();
+    a.push_back(2);
+    a.insert_sorted(1);
+    IndexedSkipList<int> b(std::move(a));
+    EXPECT_EQ(b, (IndexedSkipList<int>{ 1, 2 }));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.begin(), a.end());
+    a.push_front(7);
+    EXPECT_EQ(a.front(), 7);
+
+    std::vector<IndexedSkipList<int>> lists(1, b);
+    int* first = &lists[0].front();
+    lists.resize(8);
+    // При росте вектора списки перемещаются, узлы остаются на месте
+    EXPECT_EQ(&lists[0].front(), first);
+}
+
+struct alignas(64) Wide {
+    int value;
+    bool operator==(const Wide&) const = default;
+};
+
+TEST(IndexedSkipListTest, OverAlignedElements) {
+    IndexedSkipList<Wide> list;
+    for (int i = 0; i < 100; i++) {
+        list.push_back(Wide{ i });
+    }
+    for (size_t i = 0; i < list.size(); i++) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&list[i]) % 64, 0u);
+        EXPECT_EQ(list[i].value, int(i));
+    }
+}
+
+struct Timer {
+    int id;
+    ListHook<Timer> by_deadline;
+    ListHook<Timer> by_owner;
+    explicit Timer(int id) : id(id) {}
+};
+
+using TimerList = IntrusiveList<Timer, &Timer::by_deadline>;
+
+template <class It>
+std::vector<int> ids(It first, It last) {
+    std::vector<int> result;
+    for (; first != last; ++first) {
+        result.push_back(first->id);
+    }
+    return result;
+}
+
+TEST(IntrusiveListTest, LinksCallerObjects) {
+    Timer a(1), b(2), c(3);
+    TimerList list;
+    list.push_back(b);
+    list.push_front(a);
+    list.push_back(c);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(&list.front(), &a);
+    EXPECT_EQ(&list.back(), &c);
+    EXPECT_TRUE(b.by_deadline.is_linked());
+    EXPECT_FALSE(b.by_owner.is_linked());
+    EXPECT_EQ(ids(list.begin(), list.end()), (std::vector<int>{ 1, 2, 3 }));
+    EXPECT_EQ(ids(list.rbegin(), list.rend()), (std::vector<int>{ 3, 2, 1 }));
+
+    // Объект меняется через список без копирования
+    list.front().id = 10;
+    EXPECT_EQ(a.id, 10);
+
+    EXPECT_THROW(list.push_back(a), std::invalid_argument);
+}
+
+TEST(IntrusiveListTest, RemoveByObject) {
+    Timer t[5] = { Timer(0), Timer(1), Timer(2), Timer(3), Timer(4) };
+    TimerList list;
+    for (Timer& timer : t) {
+        list.push_back(timer);
+    }
+    list.remove(t[2]);
+    list.remove(t[0]);
+    list.remove(t[4]);
+    EXPECT_FALSE(t[2].by_deadline.is_linked());
+    EXPECT_EQ(ids(list.cbegin(), list.cend()), (std::vector<int>{ 1, 3 }));
+    EXPECT_EQ(list.back().id, 3);
+
+    auto next = list.erase(list.iterator_to(t[1]));
+    EXPECT_EQ(next->id, 3);
+    list.insert(next, t[2]);
+    EXPECT_EQ(ids(list.begin(), list.end()), (std::vector<int>{ 2, 3 }));
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(t[3].by_deadline.is_linked());
+    list.pop_back();
+    list.pop_front();
+}
+
+TEST(IntrusiveListTest, Bidirectional) {
+    static_assert(std::bidirectional_iterator<TimerList::iterator>);
+    static_assert(std::bidirectional_iterator<TimerList::const_reverse_iterator>);
+    Timer a(1), b(2), c(3);
+    TimerList list;
+    list.push_back(a);
+    list.push_back(b);
+    list.push_back(c);
+
+    // От end() назад — к последнему элементу
+    auto it = list.end();
+    --it;
+    EXPECT_EQ(&*it, &c);
+    EXPECT_EQ((it--)->id, 3);
+    EXPECT_EQ(it->id, 2);
+    EXPECT_EQ(&*(--it), &a);
+    EXPECT_EQ(it, list.begin());
+
+    auto rit = list.crend();
+    --rit;
+    EXPECT_EQ(&*rit, &a);
+    EXPECT_EQ((--rit)->id, 2);
+    EXPECT_EQ(ids(std::reverse_iterator(list.end()), std::reverse_iterator(list.begin())), (std::vector<int>{ 3, 2, 1 }));
+
+    auto last = list.erase(list.iterator_to(c));
+    EXPECT_EQ(last, list.end());
+    EXPECT_EQ(&*(--last), &b);
+    list.clear();
+}
+
+TEST(IntrusiveListTest, SeveralHooksAndMove) {
+    Timer a(1), b(2);
+    TimerList deadlines;
+    IntrusiveList<Timer, &Timer::by_owner> owned;
+    deadlines.push_back(a);
+    deadlines.push_back(b);
+    owned.push_back(b);
+    EXPECT_EQ(&owned.front(), &b);
+
+    TimerList moved(std::move(deadlines));
+    EXPECT_TRUE(deadlines.empty());
+    EXPECT_EQ(moved.size(), 2);
+    moved.pop_front();
+    EXPECT_EQ(moved.front().id, 2);
+
+    // Копия объекта не входит в список
+    Timer copy = b;
+    EXPECT_FALSE(copy.by_deadline.is_linked());
+    owned.clear();
+}
+
+TEST(ConcurrentQueueTest, SingleThread) {
+    ConcurrentQueue<std::string> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.try_pop_front().has_value());
+    queue.push_back("a");
+    std::string b = "b";
+    queue.push_back(b);
+    queue.emplace_back(3, 'c');
+    EXPECT_FALSE(queue.empty());
+    EXPECT_EQ(queue.try_pop_front(), "a");
+    EXPECT_EQ(queue.try_pop_front(), "b");
+    EXPECT_EQ(queue.try_pop_front(), "ccc");
+    EXPECT_FALSE(queue.try_pop_front().has_value());
+
+    // Оставшиеся элементы разрушаются вместе с очередью
+    for (int i = 0; i < 1000; i++) {
+        queue.push_back(std::to_string(i));
+    }
+    for (int i = 0; i < 500; i++) {
+        EXPECT_EQ(queue.try_pop_front(), std::to_string(i));
+    }
+}
+
+TEST(ConcurrentQueueTest, ManyProducersManyConsumers) {
+    const int producers = 4;
+    const int consumers = 4;
+    const int per_producer = 20000;
+    ConcurrentQueue<int> queue;
+    std::atomic<int> popped = 0;
+    std::vector<std::vector<int>> seen(consumers);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < per_producer; i++) {
+                queue.push_back(p * per_producer + i);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c] {
+            while (popped.load() < producers * per_producer) {
+                if (auto value = queue.try_pop_front()) {
+                    seen[c].push_back(*value);
+                    ++popped;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> all;
+    for (const auto& values : seen) {
+        // Элементы одного производителя потребитель видит в порядке вставки
+        std::vector<int> last(producers, -1);
+        for (int value : values) {
+            EXPECT_LT(last[value / per_producer], value);
+            last[value / per_producer] = value;
+        }
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), size_t(producers * per_producer));
+    for (int i = 0; i < producers * per_producer; i++) {
+        ASSERT_EQ(all[i], i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,96 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+using namespace std;
+
+// Токены кладутся и снимаются группами, как в разборщике: группа из 1..32
+// элементов уходит на стек, позже снимается целиком. Поэлементные
+// push/pop против push_range/pop_n.
+const size_t groups = 4000000;
+const size_t max_group = 32;
+const size_t max_depth = 512;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+struct Trace {
+    vector<unsigned char> sizes;
+    vector<bool> push;
+};
+
+Trace make_trace() {
+    mt19937 gen(3);
+    Trace t;
+    vector<size_t> open;
+    size_t depth = 0;
+    for (size_t i = 0; i < groups; i++) {
+        bool push = open.empty() || (depth + max_group <= max_depth && gen() % 2);
+        if (push) {
+            size_t k = 1 + gen() % max_group;
+            open.push_back(k);
+            depth += k;
+            t.sizes.push_back((unsigned char)k);
+        }
+        else {
+            depth -= open.back();
+            t.sizes.push_back((unsigned char)open.back());
+            open.pop_back();
+        }
+        t.push.push_back(push);
+    }
+    return t;
+}
+
+template <class S>
+void run(const char* name, const Trace& t) {
+    vector<int> tokens(max_group);
+    for (size_t i = 0; i < max_group; i++)
+        tokens[i] = int(i);
+    long long check = 0;
+    double single = measure([&] {
+        S s;
+        for (size_t i = 0; i < t.sizes.size(); i++) {
+            size_t k = t.sizes[i];
+            if (t.push[i]) {
+                for (size_t j = 0; j < k; j++)
+                    s.push(tokens[j]);
+            }
+            else {
+                check += s.top();
+                for (size_t j = 0; j < k; j++)
+                    s.pop();
+            }
+        }
+    });
+    double bulk = measure([&] {
+        S s;
+        for (size_t i = 0; i < t.sizes.size(); i++) {
+            size_t k = t.sizes[i];
+            if (t.push[i])
+                s.push_range(tokens.begin(), tokens.begin() + k);
+            else {
+                check += s.top();
+                s.pop_n(k);
+            }
+        }
+    });
+    printf("%-26s push/pop %8.2f   push_range/pop_n %8.2f ms   check=%lld\n", name, single, bulk, check);
+}
+
+int main() {
+    using namespace my_container;
+    Trace t = make_trace();
+    printf("%zu groups of 1..%zu ints, depth up to %zu\n", groups, max_group, max_depth);
+    run<Stack<int, deque<int>>>("Stack<int, deque<int>>", t);
+    run<Stack<int>>("Stack<int> (vector)", t);
+    run<Stack<int, InlineStorage<int, 64>>>("InlineStorage<int, 64>", t);
+    run<Stack<int, ChunkedStorage<int>>>("ChunkedStorage<int>", t);
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+using namespace std;
+
+// Трассы push/pop как у обхода в глубину: на каждом шаге снимаем вершину
+// со стека и кладём её непосещённых соседей.
+// shallow — много короткоживущих стеков глубиной до 8 (обход маленьких
+// деревьев); walk — один стек, глубина блуждает около тысячи;
+// deep — обход длинного пути: стек растёт до миллионов элементов и
+// опустошается.
+const size_t shallow_stacks = 500000;
+const size_t walk_ops = 20000000;
+const size_t deep_len = 4000000;
+const size_t deep_rounds = 3;
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// +1 — push, -1 — pop; глубина не выходит за [0, max_depth]
+vector<signed char> make_trace(size_t ops, size_t max_depth, unsigned seed) {
+    mt19937 gen(seed);
+    vector<signed char> trace;
+    size_t depth = 0;
+    for (size_t i = 0; i < ops; i++) {
+        bool push = depth == 0 || (depth < max_depth && gen() % 2);
+        trace.push_back(push ? 1 : -1);
+        depth += push ? 1 : -1;
+    }
+    while (depth-- > 0)
+        trace.push_back(-1);
+    return trace;
+}
+
+template <class S>
+long long replay(S& s, const vector<signed char>& trace) {
+    long long check = 0;
+    int next = 0;
+    for (signed char op : trace) {
+        if (op > 0)
+            s.push(next++);
+        else {
+            check += s.top();
+            s.pop();
+        }
+    }
+    return check;
+}
+
+template <class S>
+void run(const char* name, const vector<signed char>& small, const vector<signed char>& walk) {
+    long long check = 0;
+    double shallow = measure([&] {
+        for (size_t i = 0; i < shallow_stacks; i++) {
+            S s;
+            check += replay(s, small);
+        }
+    });
+    double walked = measure([&] {
+        S s;
+        check += replay(s, walk);
+    });
+    double deep = measure([&] {
+        S s;
+        for (size_t r = 0; r < deep_rounds; r++) {
+            for (size_t i = 0; i < deep_len; i++)
+                s.push(int(i));
+            while (!s.empty()) {
+                check += s.top();
+                s.pop();
+            }
+        }
+    });
+    printf("%-26s shallow %8.2f   walk %8.2f   deep %8.2f ms   check=%lld\n", name, shallow, walked, deep, check);
+}
+
+int main() {
+    using namespace my_container;
+    auto small = make_trace(24, 8, 1);
+    auto walk = make_trace(walk_ops, 2000, 2);
+    printf("shallow: %zu stacks x %zu ops, walk: %zu ops, deep: %zu x %zu elements\n",
+        shallow_stacks, small.size(), walk.size(), deep_rounds, deep_len);
+    run<Stack<int, deque<int>>>("Stack<int, deque<int>>", small, walk);
+    run<Stack<int>>("Stack<int> (vector)", small, walk);
+    run<Stack<int, InlineStorage<int, 32>>>("InlineStorage<int, 32>", small, walk);
+    run<Stack<int, ChunkedStorage<int>>>("ChunkedStorage<int>", small, walk);
+    return 0;
+}
@@ -4,6 +4,12 @@
 #include <iostream>
 #include <initializer_list>
 #include <compare>
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 #include <deque>
 using namespace std;
 
@@ -38,12 +44,444 @@ Container<T>::~Container() = default;
 
 namespace my_container {
 
-    template <class T>
+    // Хранилища для Stack. Подходит любой контейнер с back, push_back,
+    // emplace_back и pop_back, как у std::stack: по умолчанию это vector,
+    // можно взять и deque. Ниже два собственных варианта.
+
+    // Первые N элементов лежат прямо в объекте, без выделения памяти; при
+    // переполнении элементы переезжают в кучу, и дальше хранилище растёт
+    // как vector. Для неглубоких стеков, которые создаются и уничтожаются
+    // часто.
+    template <class T, size_t N>
+    class InlineStorage {
+        static_assert(N > 0, "InlineStorage needs a non-empty inline buffer");
+
+    private:
+        alignas(T) unsigned char inline_[N * sizeof(T)];
+        T* data_ = inline_data();
+        size_t size_ = 0;
+        size_t cap_ = N;
+
+        T* inline_data() noexcept { return reinterpret_cast<T*>(inline_); }
+        bool is_inline() const noexcept { return data_ == reinterpret_cast<const T*>(inline_); }
+        void release() noexcept {
+            if (!is_inline())
+                allocator<T>().deallocate(data_, cap_);
+            data_ = inline_data();
+            cap_ = N;
+        }
+        // Переносит элементы в буфер p ёмкостью cap. Если перемещение может
+        // бросить, элементы копируются, и при исключении старый буфер цел,
+        // а освободить p должен вызывающий.
+        void relocate(T* p, size_t cap) {
+            if constexpr (is_nothrow_move_constructible_v<T> || !is_copy_constructible_v<T>)
+                uninitialized_move(data_, data_ + size_, p);
+            else
+                uninitialized_copy(data_, data_ + size_, p);
+            destroy(data_, data_ + size_);
+            release();
+            data_ = p;
+            cap_ = cap;
+        }
+        // Поглощает содержимое s: чужой буфер в куче забирается целиком,
+        // встроенный — поэлементным перемещением.
+        void steal(InlineStorage& s) {
+            if (s.is_inline()) {
+                uninitialized_move(s.data_, s.data_ + s.size_, data_);
+                size_ = s.size_;
+                s.clear();
+            }
+            else {
+                data_ = s.data_;
+                size_ = s.size_;
+                cap_ = s.cap_;
+                s.data_ = s.inline_data();
+                s.size_ = 0;
+                s.cap_ = N;
+            }
+        }
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+
+        InlineStorage() noexcept {}
+        InlineStorage(initializer_list<T> init) : InlineStorage() {
+            reserve(init.size());
+            for (const T& val : init)
+                push_back(val);
+        }
+        InlineStorage(const InlineStorage& s) : InlineStorage() {
+            reserve(s.size_);
+            uninitialized_copy(s.data_, s.data_ + s.size_, data_);
+            size_ = s.size_;
+        }
+        InlineStorage(InlineStorage&& s) noexcept(is_nothrow_move_constructible_v<T>) : InlineStorage() { steal(s); }
+        ~InlineStorage() {
+            clear();
+            release();
+        }
+
+        InlineStorage& operator=(const InlineStorage& s) {
+            if (this != &s) {
+                clear();
+                reserve(s.size_);
+                uninitialized_copy(s.data_, s.data_ + s.size_, data_);
+                size_ = s.size_;
+            }
+            return *this;
+        }
+        InlineStorage& operator=(InlineStorage&& s) noexcept(is_nothrow_move_constructible_v<T>) {
+            if (this != &s) {
+                clear();
+                release();
+                steal(s);
+            }
+            return *this;
+        }
+        void swap(InlineStorage& s) noexcept(is_nothrow_move_constructible_v<T>) {
+            InlineStorage tmp(move(s));
+            s = move(*this);
+            *this = move(tmp);
+        }
+
+        T& back() { return data_[size_ - 1]; }
+        const T& back() const { return data_[size_ - 1]; }
+        T* data() noexcept { return data_; }
+        const T* data() const noexcept { return data_; }
+        T* begin() noexcept { return data_; }
+        T* end() noexcept { return data_ + size_; }
+        const T* begin() const noexcept { return data_; }
+        const T* end() const noexcept { return data_ + size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        size_t size() const noexcept { return size_; }
+        size_t capacity() const noexcept { return cap_; }
+        size_t max_size() const noexcept { return allocator_traits<allocator<T>>::max_size(allocator<T>()); }
+
+        void reserve(size_t cap) {
+            if (cap <= cap_)
+                return;
+            T* p = allocator<T>().allocate(cap);
+            try {
+                relocate(p, cap);
+            }
+            catch (...) {
+                allocator<T>().deallocate(p, cap);
+                throw;
+            }
+        }
+        template <class... Args>
+        T& emplace_back(Args&&... args) {
+            if (size_ < cap_) {
+                ::new (data_ + size_) T(forward<Args>(args)...);
+                return data_[size_++];
+            }
+            // Новый элемент создаётся в новом буфере до переноса старых:
+            // аргумент может ссылаться на элемент этого же хранилища.
+            size_t cap = 2 * cap_;
+            T* p = allocator<T>().allocate(cap);
+            try {
+                ::new (p + size_) T(forward<Args>(args)...);
+            }
+            catch (...) {
+                allocator<T>().deallocate(p, cap);
+                throw;
+            }
+            try {
+                relocate(p, cap);
+            }
+            catch (...) {
+                p[size_].~T();
+                allocator<T>().deallocate(p, cap);
+                throw;
+            }
+            return data_[size_++];
+        }
+        // Одна проверка ёмкости и одно блочное копирование. Как и в
+        // emplace_back, новые элементы попадают в новый буфер до переноса
+        // старых, так что диапазон может указывать в это же хранилище.
+        template <class It>
+        void append(It first, It last) {
+            if constexpr (forward_iterator<It>) {
+                size_t n = size_t(distance(first, last));
+                if (size_ + n <= cap_) {
+                    uninitialized_copy(first, last, data_ + size_);
+                    size_ += n;
+                    return;
+                }
+                size_t cap = max(2 * cap_, size_ + n);
+                T* p = allocator<T>().allocate(cap);
+                try {
+                    uninitialized_copy(first, last, p + size_);
+                }
+                catch (...) {
+                    allocator<T>().deallocate(p, cap);
+                    throw;
+                }
+                try {
+                    relocate(p, cap);
+                }
+                catch (...) {
+                    destroy(p + size_, p + size_ + n);
+                    allocator<T>().deallocate(p, cap);
+                    throw;
+                }
+                size_ += n;
+            }
+            else {
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
+        }
+        void push_back(const T& val) { emplace_back(val); }
+        void push_back(T&& val) { emplace_back(move(val)); }
+        void pop_back() { data_[--size_].~T(); }
+        void pop_back_n(size_t k) {
+            destroy(data_ + size_ - k, data_ + size_);
+            size_ -= k;
+        }
+        void clear() noexcept {
+            destroy(data_, data_ + size_);
+            size_ = 0;
+        }
+
+        bool operator==(const InlineStorage& s) const { return equal(begin(), end(), s.begin(), s.end()); }
+        auto operator<=>(const InlineStorage& s) const {
+            return lexicographical_compare_three_way(begin(), end(), s.begin(), s.end());
+        }
+    };
+
+    // Элементы лежат в блоках по C штук, которые никогда не переезжают:
+    // рост не копирует уже лежащие элементы и не требует вдвое большего
+    // непрерывного буфера. Один опустевший блок остаётся в запасе, чтобы
+    // push/pop на границе блока не выделяли и не освобождали память каждый
+    // раз. Для очень глубоких стеков.
+    template <class T, size_t C = (sizeof(T) < 4096 ? 4096 / sizeof(T) : 1)>
+    class ChunkedStorage {
+        static_assert(C > 0, "ChunkedStorage needs non-empty chunks");
+
+    private:
+        // Занятые блоки — первые used_, за ними может лежать запасной.
+        // begin_/end_/cap_end_ — начало верхнего блока, место за вершиной
+        // и конец верхнего блока, чтобы push и pop обходились без деления
+        // и отдельного счётчика. Верхний блок никогда не бывает пустым.
+        vector<T*> chunks_;
+        size_t used_ = 0;
+        T* begin_ = nullptr;
+        T* end_ = nullptr;
+        T* cap_end_ = nullptr;
+
+        T& at_index(size_t i) const { return chunks_[i / C][i % C]; }
+        // Блок, в который ляжет следующий элемент после заполненного
+        // верхнего; used_ не меняется, пока элемент не создан.
+        T* next_chunk() {
+            if (used_ == chunks_.size()) {
+                chunks_.push_back(nullptr);
+                try {
+                    chunks_.back() = allocator<T>().allocate(C);
+                }
+                catch (...) {
+                    chunks_.pop_back();
+                    throw;
+                }
+            }
+            return chunks_[used_];
+        }
+        void free_chunks(size_t keep) noexcept {
+            while (chunks_.size() > keep) {
+                allocator<T>().deallocate(chunks_.back(), C);
+                chunks_.pop_back();
+            }
+        }
+        // Верхний блок опустел: вершина переходит в конец предыдущего
+        void drop_top_chunk() noexcept {
+            used_--;
+            begin_ = used_ ? chunks_[used_ - 1] : nullptr;
+            end_ = cap_end_ = used_ ? begin_ + C : nullptr;
+            free_chunks(used_ + 1);
+        }
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+
+        ChunkedStorage() = default;
+        ChunkedStorage(initializer_list<T> init) : ChunkedStorage() {
+            for (const T& val : init)
+                push_back(val);
+        }
+        ChunkedStorage(const ChunkedStorage& s) : ChunkedStorage() {
+            for (size_t i = 0, n = s.size(); i < n; i++)
+                push_back(s.at_index(i));
+        }
+        ChunkedStorage(ChunkedStorage&& s) noexcept : ChunkedStorage() { swap(s); }
+        ~ChunkedStorage() {
+            clear();
+            free_chunks(0);
+        }
+
+        ChunkedStorage& operator=(const ChunkedStorage& s) {
+            if (this != &s) {
+                ChunkedStorage tmp(s);
+                swap(tmp);
+            }
+            return *this;
+        }
+        ChunkedStorage& operator=(ChunkedStorage&& s) noexcept {
+            if (this != &s) {
+                ChunkedStorage tmp(move(s));
+                swap(tmp);
+            }
+            return *this;
+        }
+        void swap(ChunkedStorage& s) noexcept {
+            chunks_.swap(s.chunks_);
+            std::swap(used_, s.used_);
+            std::swap(begin_, s.begin_);
+            std::swap(end_, s.end_);
+            std::swap(cap_end_, s.cap_end_);
+        }
+
+        T& back() { return end_[-1]; }
+        const T& back() const { return end_[-1]; }
+        bool empty() const noexcept { return end_ == begin_; }
+        size_t size() const noexcept { return used_ ? (used_ - 1) * C + size_t(end_ - begin_) : 0; }
+        size_t max_size() const noexcept { return allocator_traits<allocator<T>>::max_size(allocator<T>()); }
+
+        template <class... Args>
+        T& emplace_back(Args&&... args) {
+            if (end_ != cap_end_) {
+                ::new (end_) T(forward<Args>(args)...);
+                return *end_++;
+            }
+            T* slot = next_chunk();
+            ::new (slot) T(forward<Args>(args)...);
+            used_++;
+            begin_ = slot;
+            end_ = slot + 1;
+            cap_end_ = slot + C;
+            return *slot;
+        }
+        void push_back(const T& val) { emplace_back(val); }
+        void push_back(T&& val) { emplace_back(move(val)); }
+        void pop_back() {
+            (--end_)->~T();
+            if (end_ == begin_)
+                drop_top_chunk();
+        }
+        // Массовые операции копируют и уничтожают элементы кусками, по
+        // одному на каждый затронутый блок.
+        template <class It>
+        void append(It first, It last) {
+            if constexpr (forward_iterator<It>) {
+                size_t n = size_t(distance(first, last));
+                while (n > 0) {
+                    bool fresh = end_ == cap_end_;
+                    T* dst = fresh ? next_chunk() : end_;
+                    size_t k = min(n, fresh ? C : size_t(cap_end_ - end_));
+                    It mid = next(first, ptrdiff_t(k));
+                    uninitialized_copy(first, mid, dst);
+                    if (fresh) {
+                        used_++;
+                        begin_ = dst;
+                        cap_end_ = dst + C;
+                    }
+                    end_ = dst + k;
+                    first = mid;
+                    n -= k;
+                }
+            }
+            else {
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
+        }
+        void pop_back_n(size_t k) {
+            while (k > 0) {
+                size_t m = min(k, size_t(end_ - begin_));
+                destroy(end_ - m, end_);
+                end_ -= m;
+                k -= m;
+                if (end_ == begin_)
+                    drop_top_chunk();
+            }
+        }
+        // Заранее выделяет блоки под cap элементов. Когда стек уменьшается,
+        // лишние блоки снова освобождаются.
+        void reserve(size_t cap) {
+            size_t need = (cap + C - 1) / C;
+            chunks_.reserve(need);
+            while (chunks_.size() < need)
+                chunks_.push_back(allocator<T>().allocate(C));
+        }
+        void clear() noexcept {
+            while (!empty())
+                pop_back();
+        }
+
+        bool operator==(const ChunkedStorage& s) const {
+            size_t n = size();
+            if (n != s.size())
+                return false;
+            for (size_t i = 0; i < n; i++)
+                if (!(at_index(i) == s.at_index(i)))
+                    return false;
+            return true;
+        }
+        // Тип результата выводится, как у InlineStorage, чтобы хранилище
+        // оставалось пригодным для T без <=>.
+        auto operator<=>(const ChunkedStorage& s) const {
+            size_t n = size(), m = s.size();
+            for (size_t i = 0; i < min(n, m); i++)
+                if (auto cmp = at_index(i) <=> s.at_index(i); cmp != 0)
+                    return cmp;
+            return compare_three_way_result_t<T>(n <=> m);
+        }
+    };
+
+    // Стек поверх хранилища Storage, по умолчанию непрерывного vector:
+    // top/push/pop обращаются к концу одного буфера без косвенности через
+    // карту блоков, как у deque, а пустой стек ничего не выделяет.
+    template <class T, class Storage = vector<T>>
     class Stack {
     private:
-        deque<T> data_;
+        Storage data_;
+
+        // Хранилище с reserve (vector, InlineStorage) при первом push сразу
+        // получает место под 64 байта элементов, а не растёт по одному:
+        // неглубокий стек обходится одним выделением памяти.
+        static constexpr size_t initial_capacity = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+        void prepare_push() {
+            if constexpr (requires { data_.capacity(); data_.reserve(size_t()); }) {
+                if (data_.capacity() == 0)
+                    data_.reserve(initial_capacity);
+            }
+        }
+        bool aliases(const T* p) const {
+            const T* b = data_.data();
+            return !less<const T*>()(p, b) && less<const T*>()(p, b + data_.size());
+        }
+        template <class It>
+        void push_range_unchecked(It first, It last) {
+            if constexpr (requires { data_.insert(data_.end(), first, last); })
+                data_.insert(data_.end(), first, last);
+            else {
+                for (; first != last; ++first)
+                    data_.push_back(*first);
+            }
+        }
 
     public:
+        using container_type = Storage;
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+
         ~Stack() = default;
         Stack() = default;
         Stack(const Stack& s) : data_(s.data_) {}
@@ -67,11 +505,71 @@ namespace my_container {
         size_t size() const { return data_.size(); }
         size_t max_size() const { return data_.max_size(); }
 
-        void push(const T& val) { data_.push_back(val); }
-        void push(T&& val) { data_.push_back(move(val)); }
+        void push(const T& val) {
+            prepare_push();
+            data_.push_back(val);
+        }
+        void push(T&& val) {
+            prepare_push();
+            data_.push_back(move(val));
+        }
         void pop() { data_.pop_back(); }
         void swap(Stack& s) noexcept { data_.swap(s.data_); }
 
+        template <class... Args>
+        T& emplace(Args&&... args) {
+            prepare_push();
+            return data_.emplace_back(forward<Args>(args)...);
+        }
+        // Массовые операции: одна проверка ёмкости и одно блочное
+        // копирование или уничтожение. Хранилище может дать append и
+        // pop_back_n, у стандартных контейнеров берутся insert и erase в
+        // конце, иначе элементы обрабатываются по одному.
+        // Диапазон может указывать в сам стек (например, top_n()): append
+        // это допускает, а insert стандартных контейнеров нет, поэтому такой
+        // диапазон сначала копируется во временный буфер. Для хранилищ без
+        // append и data() диапазон из самого стека не допускается.
+        template <class It>
+        void push_range(It first, It last) {
+            if constexpr (requires { data_.append(first, last); })
+                data_.append(first, last);
+            else {
+                if constexpr (contiguous_iterator<It> && same_as<remove_cv_t<iter_value_t<It>>, T> && requires { data_.data(); }) {
+                    if (first != last && aliases(to_address(first))) {
+                        vector<T> tmp(first, last);
+                        push_range_unchecked(make_move_iterator(tmp.begin()), make_move_iterator(tmp.end()));
+                        return;
+                    }
+                }
+                push_range_unchecked(first, last);
+            }
+        }
+        void pop_n(size_t k) {
+            if (k > size())
+                throw out_of_range("Not enough elements in Stack");
+            if constexpr (requires { data_.pop_back_n(k); })
+                data_.pop_back_n(k);
+            else if constexpr (requires { data_.erase(data_.end() - 1, data_.end()); })
+                data_.erase(data_.end() - ptrdiff_t(k), data_.end());
+            else {
+                while (k-- > 0)
+                    data_.pop_back();
+            }
+        }
+        // Верхние k элементов от нижнего к вершине, без копирования: top()
+        // — последний элемент span. Только для непрерывных хранилищ.
+        span<T> top_n(size_t k) requires requires(Storage& s) { { s.data() } -> convertible_to<T*>; } {
+            if (k > size())
+                throw out_of_range("Not enough elements in Stack");
+            return span<T>(data_.data() + (size() - k), k);
+        }
+        span<const T> top_n(size_t k) const requires requires(const Storage& s) { { s.data() } -> convertible_to<const T*>; } {
+            if (k > size())
+                throw out_of_range("Not enough elements in Stack");
+            return span<const T>(data_.data() + (size() - k), k);
+        }
+        void reserve(size_t n) requires requires(Storage& s, size_t m) { s.reserve(m); } { data_.reserve(n); }
+
         auto operator<=>(const Stack& s) const {
             if (this->size() != s.size())
                 return this->size() <=> s.size();
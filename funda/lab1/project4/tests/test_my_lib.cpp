@@ -2,6 +2,12 @@
 #include "my_lib.hpp"
 #include <exception>
 #include <iostream>
+#include <string>
+#include <sstream>
+#include <span>
+#include <deque>
+#include <vector>
+#include <stdexcept>
 using namespace std;
 using namespace my_container;
 
@@ -60,6 +66,252 @@ TEST(StackTest, constr) {
     ASSERT_EQ(d.top(), 2);
 }
 
+// Общая проверка хранилища: переходы через границы встроенного буфера и
+// блоков, копирование, перемещение и сравнение. Строки длинные, чтобы
+// ASan поймал утечки и двойное освобождение.
+template <class S>
+void check_storage() {
+    Stack<string, S> a;
+    for (int i = 0; i < 100; i++) {
+        a.push(string(40, char('a' + i % 26)));
+        ASSERT_EQ(a.size(), size_t(i + 1));
+        ASSERT_EQ(a.top(), string(40, char('a' + i % 26)));
+    }
+    a.push(a.top());
+    ASSERT_EQ(a.top(), string(40, char('a' + 99 % 26)));
+    a.pop();
+    Stack<string, S> b(a);
+    ASSERT_TRUE(a == b);
+    b.pop();
+    ASSERT_TRUE(b < a);
+    Stack<string, S> c(move(b));
+    ASSERT_EQ(c.size(), 99u);
+    b = c;
+    ASSERT_TRUE(b == c);
+    c = move(a);
+    ASSERT_EQ(c.size(), 100u);
+    c.swap(b);
+    ASSERT_EQ(c.size(), 99u);
+    ASSERT_EQ(b.size(), 100u);
+    for (int i = 98; i >= 0; i--) {
+        ASSERT_EQ(c.top(), string(40, char('a' + i % 26)));
+        c.pop();
+    }
+    ASSERT_TRUE(c.empty());
+    c.push("again");
+    ASSERT_EQ(c.top(), "again");
+}
+
+TEST(StackTest, test_storages) {
+    check_storage<vector<string>>();
+    check_storage<deque<string>>();
+    check_storage<InlineStorage<string, 1>>();
+    check_storage<InlineStorage<string, 8>>();
+    check_storage<InlineStorage<string, 200>>();
+    check_storage<ChunkedStorage<string, 1>>();
+    check_storage<ChunkedStorage<string, 7>>();
+    check_storage<ChunkedStorage<string>>();
+}
+
+TEST(StackTest, test_inline_storage) {
+    InlineStorage<int, 4> s{ 1, 2, 3 };
+    auto inside = [&s] {
+        auto p = reinterpret_cast<const char*>(s.data());
+        return p >= reinterpret_cast<const char*>(&s) && p < reinterpret_cast<const char*>(&s + 1);
+    };
+    ASSERT_TRUE(inside());
+    s.push_back(4);
+    ASSERT_TRUE(inside());
+    ASSERT_EQ(s.capacity(), 4u);
+    s.push_back(5);
+    ASSERT_FALSE(inside());
+    ASSERT_EQ(s.capacity(), 8u);
+    InlineStorage<int, 4> t(move(s));
+    ASSERT_EQ(t.size(), 5u);
+    ASSERT_TRUE(s.empty());
+    ASSERT_TRUE(inside());
+}
+
+// Копия бросает, когда кончается бюджет; перемещение не noexcept, поэтому
+// InlineStorage при росте копирует элементы. Деструктор нетривиален.
+struct ThrowingCopy {
+    inline static int budget = -1;
+    string value;
+    explicit ThrowingCopy(int v) : value(to_string(v)) {}
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+        if (budget == 0)
+            throw runtime_error("copy");
+        if (budget > 0)
+            budget--;
+    }
+    ThrowingCopy(ThrowingCopy&& other) : value(move(other.value)) {}
+    ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+
+TEST(StackTest, test_inline_storage_throwing_copy) {
+    InlineStorage<ThrowingCopy, 2> s;
+    s.emplace_back(1);
+    s.emplace_back(2);
+    // Исключение при переносе в новый буфер: хранилище остаётся прежним
+    ThrowingCopy::budget = 1;
+    ASSERT_THROW(s.emplace_back(3), runtime_error);
+    ThrowingCopy::budget = 0;
+    ASSERT_THROW(s.reserve(16), runtime_error);
+    ThrowingCopy::budget = -1;
+    ASSERT_EQ(s.size(), 2u);
+    ASSERT_EQ(s.capacity(), 2u);
+    ASSERT_EQ(s.data()[0].value, "1");
+    ASSERT_EQ(s.back().value, "2");
+
+    s.emplace_back(3);
+    ASSERT_EQ(s.size(), 3u);
+    ASSERT_EQ(s.back().value, "3");
+}
+
+TEST(StackTest, test_chunked_storage) {
+    Stack<int, ChunkedStorage<int, 16>> s{ 0 };
+    const int* bottom = &s.top();
+    for (int i = 1; i < 1000; i++)
+        s.push(i);
+    for (int i = 999; i > 0; i--) {
+        ASSERT_EQ(s.top(), i);
+        s.pop();
+    }
+    // Блоки не переезжают при росте: нижний элемент остался на месте
+    ASSERT_EQ(&s.top(), bottom);
+    ASSERT_EQ(s.top(), 0);
+}
+
+// Тип только с ==: хранилища не должны требовать <=> от элементов
+struct EqualityOnly {
+    int value;
+    bool operator==(const EqualityOnly&) const = default;
+};
+
+template <class S>
+void check_equality_only() {
+    Stack<EqualityOnly, S> a, b;
+    for (int i = 0; i < 20; i++) {
+        a.push(EqualityOnly{ i });
+        b.push(EqualityOnly{ i });
+    }
+    ASSERT_TRUE(a == b);
+    b.pop();
+    ASSERT_TRUE(a != b);
+    ASSERT_EQ(a.top().value, 19);
+}
+
+TEST(StackTest, test_equality_only) {
+    check_equality_only<vector<EqualityOnly>>();
+    check_equality_only<InlineStorage<EqualityOnly, 4>>();
+    check_equality_only<ChunkedStorage<EqualityOnly, 8>>();
+
+    ChunkedStorage<double, 2> x, y;
+    x.push_back(1.0);
+    y.push_back(1.0);
+    y.push_back(0.5);
+    ASSERT_TRUE(x < y);
+    ASSERT_TRUE((x <=> y) == partial_ordering::less);
+}
+
+// Массовые операции на всех хранилищах: диапазоны пересекают границы
+// встроенного буфера и блоков, вход может быть однопроходным.
+template <class S>
+void check_bulk() {
+    vector<string> tokens;
+    for (int i = 0; i < 100; i++)
+        tokens.push_back(string(30, char('a' + i % 26)) + to_string(i));
+    Stack<string, S> s;
+    s.emplace(3, 'x');
+    ASSERT_EQ(s.top(), "xxx");
+    string* y = &s.emplace("y");
+    ASSERT_EQ(y, &s.top());
+    s.push_range(tokens.begin(), tokens.end());
+    ASSERT_EQ(s.size(), 102u);
+    ASSERT_EQ(s.top(), tokens.back());
+    s.pop_n(0);
+    s.pop_n(60);
+    ASSERT_EQ(s.size(), 42u);
+    ASSERT_EQ(s.top(), tokens[39]);
+    if constexpr (requires { s.top_n(1); }) {
+        auto top = s.top_n(3);
+        ASSERT_EQ(top.size(), 3u);
+        ASSERT_EQ(top[0], tokens[37]);
+        ASSERT_EQ(&top[2], &s.top());
+        // Диапазон из самого стека: при росте буфер переезжает
+        s.push_range(top.begin(), top.end());
+        ASSERT_EQ(s.size(), 45u);
+        ASSERT_EQ(s.top(), tokens[39]);
+        s.pop_n(3);
+        ASSERT_THROW(s.top_n(43), out_of_range);
+    }
+    istringstream in("p q r");
+    s.push_range(istream_iterator<string>(in), istream_iterator<string>());
+    ASSERT_EQ(s.size(), 45u);
+    ASSERT_EQ(s.top(), "r");
+    ASSERT_THROW(s.pop_n(46), out_of_range);
+    ASSERT_EQ(s.size(), 45u);
+    s.pop_n(45);
+    ASSERT_TRUE(s.empty());
+    s.push_range(tokens.begin(), tokens.begin() + 5);
+    ASSERT_EQ(s.top(), tokens[4]);
+}
+
+TEST(StackTest, test_bulk) {
+    check_bulk<vector<string>>();
+    check_bulk<deque<string>>();
+    check_bulk<InlineStorage<string, 1>>();
+    check_bulk<InlineStorage<string, 64>>();
+    check_bulk<ChunkedStorage<string, 1>>();
+    check_bulk<ChunkedStorage<string, 7>>();
+}
+
+TEST(StackTest, test_push_range_self) {
+    // Буфер vector заполнен целиком: вставка своих же элементов переносит его
+    Stack<string> s;
+    s.reserve(4);
+    for (int i = 0; i < 4; i++)
+        s.push(string(40, char('a' + i)));
+    auto top = s.top_n(4);
+    s.push_range(top.begin(), top.end());
+    auto half = s.top_n(2);
+    s.push_range(half.begin(), half.end());
+    ASSERT_EQ(s.size(), 10u);
+    auto all = s.top_n(10);
+    for (size_t i = 0; i < 8; i++)
+        ASSERT_EQ(all[i], string(40, char('a' + i % 4)));
+    ASSERT_EQ(all[8], string(40, 'c'));
+    ASSERT_EQ(s.top(), string(40, 'd'));
+}
+
+template <class S>
+concept HasTopN = requires(S& s) { s.top_n(1); };
+
+TEST(StackTest, test_reserve) {
+    Stack<int> a;
+    a.reserve(100);
+    a.push(0);
+    const int* p = &a.top();
+    vector<int> v(99, 1);
+    a.push_range(v.begin(), v.end());
+    ASSERT_EQ(a.top_n(100).data(), p);
+
+    Stack<int, InlineStorage<int, 4>> b;
+    b.reserve(50);
+    b.push(0);
+    p = &b.top();
+    b.push_range(v.begin(), v.begin() + 49);
+    ASSERT_EQ(b.top_n(50).data(), p);
+    const auto& cb = b;
+    static_assert(is_same_v<decltype(cb.top_n(1)), span<const int>>);
+
+    Stack<int, ChunkedStorage<int, 8>> c;
+    c.reserve(100);
+    c.push_range(v.begin(), v.end());
+    ASSERT_EQ(c.size(), 99u);
+    static_assert(!HasTopN<decltype(c)>);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,58 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+using namespace std;
+
+// Загрузка таблицы признаков при старте: сборка Vector через push_back
+// против повторного открытия уже записанного MappedVector.
+struct Feature {
+    int id;
+    float weight;
+    long long stamp;
+    auto operator<=>(const Feature&) const = default;
+};
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    const size_t n = 20000000;
+    const char* path = "bench_mapped_vector.bin";
+    remove(path);
+    long long check = 0;
+
+    double write = measure([&] {
+        my_container::MappedVector<Feature> v(path);
+        v.reserve(n);
+        for (size_t i = 0; i < n; i++)
+            v.push_back(Feature{ int(i), float(i) / 2, (long long)i });
+        v.sync();
+    });
+    double load = measure([&] {
+        my_container::Vector<Feature> v;
+        for (size_t i = 0; i < n; i++)
+            v.push_back(Feature{ int(i), float(i) / 2, (long long)i });
+        check += v[n / 2].id;
+    });
+    double reopen = measure([&] {
+        my_container::MappedVector<Feature> v(path);
+        check += v[n / 2].id;
+    });
+    double scan = measure([&] {
+        my_container::MappedVector<Feature> v(path);
+        for (const Feature& f : v)
+            check += f.id;
+    });
+    remove(path);
+
+    printf("n=%zu records of %zu bytes\n", n, sizeof(Feature));
+    printf("%-32s %10.2f ms\n", "MappedVector write + sync", write);
+    printf("%-32s %10.2f ms\n", "Vector push_back load", load);
+    printf("%-32s %10.2f ms\n", "MappedVector reopen", reopen);
+    printf("%-32s %10.2f ms  check=%lld\n", "MappedVector reopen + full scan", scan, check);
+    return 0;
+}
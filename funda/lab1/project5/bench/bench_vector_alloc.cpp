@@ -0,0 +1,51 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+using namespace std;
+
+// Сборка и выброс: каждый запрос строит rounds векторов по len элементов,
+// держит их до конца запроса и затем выбрасывает все разом.
+const size_t requests = 2000;
+const size_t rounds = 1000;
+const size_t len = 24;
+
+template <class Inner, class Outer, class Reset>
+void run(const char* name, Outer make_batch, Reset end_request) {
+    long long check = 0;
+    auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < requests; r++) {
+        {
+            auto batch = make_batch();
+            batch.reserve(rounds);
+            for (size_t i = 0; i < rounds; i++) {
+                Inner& v = batch.emplace_back(batch.get_allocator());
+                for (size_t j = 0; j < len; j++)
+                    v.push_back(int(i + j));
+            }
+            check += batch.back().back();
+        }
+        end_request();
+    }
+    auto ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    printf("%-24s %10.2f ms  check=%lld\n", name, ms, check);
+}
+
+int main() {
+    using namespace my_container;
+    printf("%zu requests x %zu vectors x %zu ints\n", requests, rounds, len);
+
+    using HeapVec = Vector<int>;
+    run<HeapVec>("std::allocator", [] { return Vector<HeapVec>(); }, [] {});
+
+    Arena arena;
+    using ArenaVec = Vector<int, ArenaAllocator<int>>;
+    run<ArenaVec>("ArenaAllocator",
+        [&] { return Vector<ArenaVec, ArenaAllocator<ArenaVec>>(arena); },
+        [&] { arena.reset(); });
+
+    Pool pool;
+    using PoolVec = Vector<int, PoolAllocator<int>>;
+    run<PoolVec>("PoolAllocator",
+        [&] { return Vector<PoolVec, PoolAllocator<PoolVec>>(pool); }, [] {});
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+using namespace std;
+
+static size_t allocations = 0;
+
+void* operator new(size_t n) {
+    allocations++;
+    if (void* p = malloc(n ? n : 1))
+        return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+struct Counters {
+    size_t copies = 0;
+    size_t moves = 0;
+    size_t defaults = 0;
+};
+static Counters counters;
+
+// Строка с подсчётом копирований и перемещений.
+struct Payload {
+    string s;
+    Payload() { counters.defaults++; }
+    explicit Payload(string str) : s(move(str)) {}
+    Payload(const Payload& p) : s(p.s) { counters.copies++; }
+    Payload(Payload&& p) noexcept : s(move(p.s)) { counters.moves++; }
+    Payload& operator=(const Payload& p) {
+        s = p.s;
+        counters.copies++;
+        return *this;
+    }
+    Payload& operator=(Payload&& p) noexcept {
+        s = move(p.s);
+        counters.moves++;
+        return *this;
+    }
+    auto operator<=>(const Payload&) const = default;
+};
+
+// Прежняя схема роста Vector: new T[] и копирующее присваивание.
+template <class T>
+struct LegacyVector {
+    T* data = nullptr;
+    size_t size = 0;
+    size_t capacity = 0;
+    void reallocate(size_t new_capacity) {
+        T* new_data = new T[new_capacity];
+        for (size_t i = 0; i < size; i++)
+            new_data[i] = data[i];
+        delete[] data;
+        data = new_data;
+        capacity = new_capacity;
+    }
+    void push_back(T&& val) {
+        if (size == capacity)
+            reallocate(capacity ? 2 * capacity : 2);
+        data[size++] = move(val);
+    }
+    ~LegacyVector() { delete[] data; }
+};
+
+template <class Vec>
+void run(const char* name, size_t n) {
+    counters = Counters();
+    size_t before = allocations;
+    auto start = chrono::steady_clock::now();
+    {
+        Vec v;
+        for (size_t i = 0; i < n; i++)
+            v.push_back(Payload(string(32, char('a' + i % 26))));
+    }
+    auto ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    printf("%-16s n=%-9zu %10.2f ms  allocs=%-9zu copies=%-9zu moves=%-9zu defaults=%zu\n",
+        name, n, ms, allocations - before, counters.copies, counters.moves, counters.defaults);
+}
+
+int main() {
+    for (size_t n : { 1000u, 100000u, 1000000u }) {
+        run<LegacyVector<Payload>>("legacy", n);
+        run<my_container::Vector<Payload>>("my_container", n);
+        run<vector<Payload>>("std::vector", n);
+    }
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+using namespace std;
+
+struct Record {
+    int id;
+    int value;
+    long long stamp;
+    auto operator<=>(const Record&) const = default;
+};
+
+template <class Vec>
+void run(const char* name, size_t n) {
+    auto start = chrono::steady_clock::now();
+    Vec v;
+    for (size_t i = 0; i < n; i++)
+        v.push_back(Record{ int(i), int(i / 2), (long long)i });
+    auto ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    printf("%-24s n=%-9zu %10.2f ms  capacity=%zu  check=%d\n", name, n, ms, v.capacity(), v[n / 2].id);
+}
+
+int main() {
+    const size_t n = 10000000;
+    run<my_container::Vector<Record>>("Vector<DoubleGrowth>", n);
+    run<my_container::Vector<Record, allocator<Record>, my_container::HalfGrowth>>("Vector<HalfGrowth>", n);
+    run<my_container::Vector<Record, allocator<Record>, my_container::PageGrowth<>>>("Vector<PageGrowth>", n);
+    run<vector<Record>>("std::vector", n);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+using namespace std;
+
+// Та же раскладка, что у T, но с пользовательскими конструкторами:
+// Vector выбирает для неё поэлементный путь.
+template <class T>
+struct Opaque {
+    T val;
+    Opaque(T val) : val(val) {}
+    Opaque(const Opaque& o) : val(o.val) {}
+    Opaque(Opaque&& o) noexcept : val(o.val) {}
+    Opaque& operator=(const Opaque& o) {
+        val = o.val;
+        return *this;
+    }
+    Opaque& operator=(Opaque&& o) noexcept {
+        val = o.val;
+        return *this;
+    }
+    ~Opaque() {}
+    auto operator<=>(const Opaque&) const = default;
+};
+
+template <class F>
+double measure(F f) {
+    auto start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template <class E>
+void run(const char* name) {
+    const size_t n = 10000000;
+    const size_t shifts = 200;
+    my_container::Vector<E> v;
+    double grow = measure([&] {
+        for (size_t i = 0; i < n; i++)
+            v.emplace_back(i);
+    });
+    double copy = measure([&] {
+        my_container::Vector<E> c(v);
+        if (c.size() != v.size())
+            printf("size mismatch\n");
+    });
+    my_container::Vector<E> small(1000000, E(1));
+    double shift = measure([&] {
+        for (size_t i = 0; i < shifts; i++) {
+            small.emplace(small.cbegin(), i);
+            small.erase(small.cbegin() + 1);
+        }
+    });
+    printf("%-20s grow %8.2f ms  copy %8.2f ms  insert/erase at front x%zu %8.2f ms\n",
+        name, grow, copy, shifts, shift);
+}
+
+int main() {
+    run<int>("int");
+    run<Opaque<int>>("Opaque<int>");
+    run<double>("double");
+    run<Opaque<double>>("Opaque<double>");
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include "my_lib.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+using namespace std;
+using my_container::Vector;
+namespace simd = my_container::simd;
+
+// Скорость сравнения, поиска, подсчёта и заполнения для каждого доступного
+// набора инструкций. Время приведено к одному проходу по вектору.
+template <class F>
+double measure(size_t reps, F f) {
+    auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < reps; r++)
+        f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / reps;
+}
+
+const char* isa_name(simd::Isa isa) {
+    switch (isa) {
+    case simd::Isa::avx2: return "avx2";
+    case simd::Isa::sse2: return "sse2";
+    default: return "scalar";
+    }
+}
+
+template <class T>
+void run(const char* type, size_t n) {
+    size_t reps = max<size_t>(1, 200000000 / n);
+    Vector<T> a(n, T(1));
+    Vector<T> b(n, T(1));
+    b.back() = T(2);
+    size_t sink = 0;
+    for (simd::Isa isa : { simd::Isa::scalar, simd::Isa::sse2, simd::Isa::avx2 }) {
+        simd::limit_isa(isa);
+        if (simd::isa() != isa)
+            continue;
+        double eq = measure(reps, [&] { sink += a == b; });
+        double cmp = measure(reps, [&] { sink += (a <=> b) < 0; });
+        double find = measure(reps, [&] { sink += a.find(T(2)) - a.begin(); });
+        double count = measure(reps, [&] { sink += a.count(T(1)); });
+        double fill = measure(reps, [&] { sink += Vector<T>(n, T(3)).size(); });
+        printf("%-6s %-6s n=%-10zu ==%9.3f  <=>%9.3f  find%9.3f  count%9.3f  fill%9.3f ms\n",
+            type, isa_name(isa), n, eq, cmp, find, count, fill);
+    }
+    simd::limit_isa(simd::Isa::avx2);
+    if (!sink)
+        printf("unexpected\n");
+}
+
+int main() {
+    for (size_t n = 1000; n <= 100000000; n *= 10) {
+        run<int32_t>("int32", n);
+        run<float>("float", n);
+    }
+    return 0;
+}
@@ -5,6 +5,29 @@
 #include <initializer_list>
 #include <compare>
 #include <algorithm>
+#include <memory>
+#include <utility>
+#include <stdexcept>
+#include <cstring>
+#include <concepts>
+#include <type_traits>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <string>
+#include <system_error>
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if !defined(MY_CONTAINER_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && defined(__GNUC__)
+#define MY_CONTAINER_SIMD_X86
+#include <immintrin.h>
+#endif
 using namespace std;
 
 template <class T>
@@ -38,41 +61,920 @@ Container<T>::~Container() = default;
 
 namespace my_container {
 
+    // Стратегии роста ёмкости Vector: next(capacity, elem_size) возвращает
+    // новую ёмкость в элементах.
+    struct DoubleGrowth {
+        static size_t next(size_t capacity, size_t) noexcept {
+            return capacity ? 2 * capacity : 2;
+        }
+    };
+
+    struct HalfGrowth {
+        static size_t next(size_t capacity, size_t) noexcept {
+            return capacity < 2 ? capacity + 2 : capacity + capacity / 2;
+        }
+    };
+
+    // Удвоение с округлением размера буфера вверх до целого числа страниц.
+    template <size_t PageSize = 4096>
+    struct PageGrowth {
+        static size_t next(size_t capacity, size_t elem_size) noexcept {
+            size_t bytes = capacity ? 2 * capacity * elem_size : elem_size;
+            bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+            return bytes / elem_size;
+        }
+    };
+
+    // Арена с выделением сдвигом указателя. Память отдельных объектов не
+    // освобождается (кроме последнего выделенного блока); reset() возвращает
+    // всё разом, оставляя последний блок арены для повторного использования.
+    class Arena {
+    private:
+        struct Block {
+            Block* next;
+            size_t size;
+        };
+        static constexpr size_t header_size = (sizeof(Block) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+
+        Block* head_ = nullptr;
+        uintptr_t cur_ = 0;
+        uintptr_t end_ = 0;
+        size_t block_size_;
+
+        static uintptr_t align_up(uintptr_t p, size_t align) noexcept { return (p + align - 1) & ~(uintptr_t)(align - 1); }
+        static uintptr_t block_begin(Block* b) noexcept { return reinterpret_cast<uintptr_t>(b) + header_size; }
+        void add_block(size_t min_size) {
+            size_t size = max(block_size_, min_size);
+            Block* b = static_cast<Block*>(::operator new(header_size + size));
+            b->next = head_;
+            b->size = size;
+            head_ = b;
+            cur_ = block_begin(b);
+            end_ = cur_ + size;
+        }
+
+    public:
+        explicit Arena(size_t block_size = 64 * 1024) : block_size_(block_size) {}
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+        ~Arena() { release(); }
+
+        void* allocate(size_t bytes, size_t align) {
+            uintptr_t p = align_up(cur_, align);
+            if (!head_ || p + bytes > end_ || p < cur_) {
+                add_block(bytes + align);
+                p = align_up(cur_, align);
+            }
+            cur_ = p + bytes;
+            return reinterpret_cast<void*>(p);
+        }
+        void deallocate(void* ptr, size_t bytes) noexcept {
+            if (reinterpret_cast<uintptr_t>(ptr) + bytes == cur_)
+                cur_ = reinterpret_cast<uintptr_t>(ptr);
+        }
+        void reset() noexcept {
+            if (!head_)
+                return;
+            while (head_->next) {
+                Block* next = head_->next;
+                head_->next = next->next;
+                ::operator delete(next);
+            }
+            cur_ = block_begin(head_);
+            end_ = cur_ + head_->size;
+        }
+        void release() noexcept {
+            while (head_) {
+                Block* next = head_->next;
+                ::operator delete(head_);
+                head_ = next;
+            }
+            cur_ = end_ = 0;
+        }
+        size_t blocks() const noexcept {
+            size_t cnt = 0;
+            for (Block* b = head_; b; b = b->next)
+                cnt++;
+            return cnt;
+        }
+    };
+
+    // Пул с классами размеров 16, 32, ..., 1024 байт: блоки каждого класса
+    // нарезаются из больших кусков и после освобождения переиспользуются.
+    // Большие и сверхвыровненные запросы уходят в operator new.
+    class Pool {
+    private:
+        struct FreeNode {
+            FreeNode* next;
+        };
+        struct Chunk {
+            Chunk* next;
+        };
+        static constexpr size_t min_class = 16;
+        static constexpr size_t max_class = 1024;
+        static constexpr size_t classes = 7;
+        static constexpr size_t header_size = (sizeof(Chunk) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+
+        FreeNode* free_[classes] = {};
+        Chunk* chunks_ = nullptr;
+        size_t chunk_size_;
+
+        static bool pooled(size_t bytes, size_t align) noexcept { return bytes <= max_class && align <= alignof(max_align_t); }
+        static size_t class_index(size_t bytes) noexcept {
+            size_t index = 0;
+            for (size_t c = min_class; c < bytes; c <<= 1)
+                index++;
+            return index;
+        }
+        void refill(size_t index) {
+            size_t block = min_class << index;
+            size_t cnt = max<size_t>(chunk_size_ / block, 1);
+            Chunk* chunk = static_cast<Chunk*>(::operator new(header_size + cnt * block));
+            chunk->next = chunks_;
+            chunks_ = chunk;
+            char* p = reinterpret_cast<char*>(chunk) + header_size;
+            for (size_t i = 0; i < cnt; i++, p += block) {
+                FreeNode* node = reinterpret_cast<FreeNode*>(p);
+                node->next = free_[index];
+                free_[index] = node;
+            }
+        }
+
+    public:
+        explicit Pool(size_t chunk_size = 64 * 1024) : chunk_size_(chunk_size) {}
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
+        ~Pool() { release(); }
+
+        void* allocate(size_t bytes, size_t align) {
+            if (!pooled(bytes, align))
+                return ::operator new(bytes, align_val_t(align));
+            size_t index = class_index(bytes);
+            if (!free_[index])
+                refill(index);
+            FreeNode* node = free_[index];
+            free_[index] = node->next;
+            return node;
+        }
+        void deallocate(void* ptr, size_t bytes, size_t align) noexcept {
+            if (!pooled(bytes, align)) {
+                ::operator delete(ptr, bytes, align_val_t(align));
+                return;
+            }
+            size_t index = class_index(bytes);
+            FreeNode* node = static_cast<FreeNode*>(ptr);
+            node->next = free_[index];
+            free_[index] = node;
+        }
+        // Возвращает все куски; блоки, выданные из пула, становятся недействительными.
+        void release() noexcept {
+            while (chunks_) {
+                Chunk* next = chunks_->next;
+                ::operator delete(chunks_);
+                chunks_ = next;
+            }
+            for (auto& head : free_)
+                head = nullptr;
+        }
+    };
+
+    // Аллокаторы-обёртки над Arena и Pool в духе std::allocator_traits.
+    template <class T>
+    class ArenaAllocator {
+    private:
+        template <class U>
+        friend class ArenaAllocator;
+        Arena* arena_;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = true_type;
+        using propagate_on_container_swap = true_type;
+
+        ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+        template <class U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena_) {}
+
+        T* allocate(size_t cnt) {
+            if (cnt > (size_t)(-1) / sizeof(T))
+                throw bad_array_new_length();
+            return static_cast<T*>(arena_->allocate(cnt * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* ptr, size_t cnt) noexcept { arena_->deallocate(ptr, cnt * sizeof(T)); }
+        Arena& arena() const noexcept { return *arena_; }
+
+        template <class U>
+        bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena_ == other.arena_; }
+    };
+
+    template <class T>
+    class PoolAllocator {
+    private:
+        template <class U>
+        friend class PoolAllocator;
+        Pool* pool_;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = true_type;
+        using propagate_on_container_swap = true_type;
+
+        PoolAllocator(Pool& pool) noexcept : pool_(&pool) {}
+        template <class U>
+        PoolAllocator(const PoolAllocator<U>& other) noexcept : pool_(other.pool_) {}
+
+        T* allocate(size_t cnt) {
+            if (cnt > (size_t)(-1) / sizeof(T))
+                throw bad_array_new_length();
+            return static_cast<T*>(pool_->allocate(cnt * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* ptr, size_t cnt) noexcept { pool_->deallocate(ptr, cnt * sizeof(T), alignof(T)); }
+        Pool& pool() const noexcept { return *pool_; }
+
+        template <class U>
+        bool operator==(const PoolAllocator<U>& other) const noexcept { return pool_ == other.pool_; }
+    };
+
+    // Векторные ядра для арифметических типов: сравнение, поиск, подсчёт и
+    // заполнение. Набор инструкций (AVX2, SSE2 или скалярный код) выбирается
+    // при первом вызове по возможностям процессора, поэтому сборка не требует
+    // -mavx2 и запускается на любом x86-64.
+    namespace simd {
+
+        enum class Isa { scalar, sse2, avx2 };
+
+        template <class T>
+        concept vectorizable = (is_integral_v<T> && sizeof(T) <= 8) || is_same_v<T, float> || is_same_v<T, double>;
+
+        namespace detail {
+
+            // Скалярные ядра; векторные версии передают им хвост как p + i, n - i,
+            // чтобы граница цикла оставалась очевидной компилятору.
+            template <class T>
+            size_t mismatch_scalar(const T* a, const T* b, size_t n) noexcept {
+                for (size_t i = 0; i < n; i++) {
+                    if (!(a[i] == b[i]))
+                        return i;
+                }
+                return n;
+            }
+            template <class T>
+            size_t find_scalar(const T* p, size_t n, T val) noexcept {
+                for (size_t i = 0; i < n; i++) {
+                    if (p[i] == val)
+                        return i;
+                }
+                return n;
+            }
+            template <class T>
+            size_t count_scalar(const T* p, size_t n, T val) noexcept {
+                size_t cnt = 0;
+                for (size_t i = 0; i < n; i++)
+                    cnt += p[i] == val;
+                return cnt;
+            }
+            template <class T>
+            void fill_scalar(T* p, size_t n, T val) noexcept {
+                for (size_t i = 0; i < n; i++)
+                    p[i] = val;
+            }
+
+#if defined(MY_CONTAINER_SIMD_X86)
+            // Битовое представление T нужной ширины для set1.
+            template <class T>
+            using lane_bits = conditional_t<sizeof(T) == 1, uint8_t, conditional_t<sizeof(T) == 2, uint16_t,
+                conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+            // SSE2 входит в базовый набор x86-64. Сравнения дают маску байтов,
+            // в которой у равных элементов взведены все sizeof(T) битов.
+            template <class T>
+            __m128i eq_sse2(__m128i a, __m128i b) noexcept {
+                if constexpr (is_same_v<T, float>)
+                    return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+                else if constexpr (is_same_v<T, double>)
+                    return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+                else if constexpr (sizeof(T) == 1)
+                    return _mm_cmpeq_epi8(a, b);
+                else if constexpr (sizeof(T) == 2)
+                    return _mm_cmpeq_epi16(a, b);
+                else if constexpr (sizeof(T) == 4)
+                    return _mm_cmpeq_epi32(a, b);
+                else {
+                    // В SSE2 нет сравнения 64-битных целых: обе половины должны совпасть.
+                    __m128i r = _mm_cmpeq_epi32(a, b);
+                    return _mm_and_si128(r, _mm_shuffle_epi32(r, 0xB1));
+                }
+            }
+            template <class T>
+            __m128i set1_sse2(T val) noexcept {
+                auto bits = bit_cast<lane_bits<T>>(val);
+                if constexpr (sizeof(T) == 1)
+                    return _mm_set1_epi8(char(bits));
+                else if constexpr (sizeof(T) == 2)
+                    return _mm_set1_epi16(short(bits));
+                else if constexpr (sizeof(T) == 4)
+                    return _mm_set1_epi32(int(bits));
+                else
+                    return _mm_set1_epi64x((long long)bits);
+            }
+            inline __m128i load_sse2(const void* p) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+            inline unsigned mask_sse2(__m128i eq) noexcept { return unsigned(_mm_movemask_epi8(eq)); }
+
+            template <class T>
+            size_t mismatch_sse2(const T* a, const T* b, size_t n) noexcept {
+                constexpr size_t lanes = 16 / sizeof(T);
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    unsigned m = mask_sse2(eq_sse2<T>(load_sse2(a + i), load_sse2(b + i)));
+                    if (m != 0xFFFF)
+                        return i + countr_zero(~m) / sizeof(T);
+                }
+                return i + mismatch_scalar(a + i, b + i, n - i);
+            }
+            template <class T>
+            size_t find_sse2(const T* p, size_t n, T val) noexcept {
+                constexpr size_t lanes = 16 / sizeof(T);
+                __m128i v = set1_sse2(val);
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    if (unsigned m = mask_sse2(eq_sse2<T>(load_sse2(p + i), v)))
+                        return i + countr_zero(m) / sizeof(T);
+                }
+                return i + find_scalar(p + i, n - i, val);
+            }
+            template <class T>
+            size_t count_sse2(const T* p, size_t n, T val) noexcept {
+                constexpr size_t lanes = 16 / sizeof(T);
+                // POPCNT не входит в базовый x86-64: совпавшие байты суммируются psadbw.
+                __m128i v = set1_sse2(val);
+                __m128i ones = _mm_set1_epi8(1);
+                __m128i bytes = _mm_setzero_si128();
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    __m128i eq = _mm_and_si128(eq_sse2<T>(load_sse2(p + i), v), ones);
+                    bytes = _mm_add_epi64(bytes, _mm_sad_epu8(eq, _mm_setzero_si128()));
+                }
+                alignas(16) uint64_t sums[2];
+                _mm_store_si128(reinterpret_cast<__m128i*>(sums), bytes);
+                return size_t(sums[0] + sums[1]) / sizeof(T) + count_scalar(p + i, n - i, val);
+            }
+            template <class T>
+            void fill_sse2(T* p, size_t n, T val) noexcept {
+                constexpr size_t lanes = 16 / sizeof(T);
+                __m128i v = set1_sse2(val);
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes)
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), v);
+                fill_scalar(p + i, n - i, val);
+            }
+
+            // AVX2: те же ядра на 256-битных регистрах. Компилируются с
+            // атрибутом target и вызываются только после проверки процессора.
+            template <class T>
+            [[gnu::target("avx2,popcnt")]] __m256i eq_avx2(__m256i a, __m256i b) noexcept {
+                if constexpr (is_same_v<T, float>)
+                    return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+                else if constexpr (is_same_v<T, double>)
+                    return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+                else if constexpr (sizeof(T) == 1)
+                    return _mm256_cmpeq_epi8(a, b);
+                else if constexpr (sizeof(T) == 2)
+                    return _mm256_cmpeq_epi16(a, b);
+                else if constexpr (sizeof(T) == 4)
+                    return _mm256_cmpeq_epi32(a, b);
+                else
+                    return _mm256_cmpeq_epi64(a, b);
+            }
+            template <class T>
+            [[gnu::target("avx2,popcnt")]] __m256i set1_avx2(T val) noexcept {
+                auto bits = bit_cast<lane_bits<T>>(val);
+                if constexpr (sizeof(T) == 1)
+                    return _mm256_set1_epi8(char(bits));
+                else if constexpr (sizeof(T) == 2)
+                    return _mm256_set1_epi16(short(bits));
+                else if constexpr (sizeof(T) == 4)
+                    return _mm256_set1_epi32(int(bits));
+                else
+                    return _mm256_set1_epi64x((long long)bits);
+            }
+            [[gnu::target("avx2,popcnt")]] inline __m256i load_avx2(const void* p) noexcept {
+                return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+            }
+            [[gnu::target("avx2,popcnt")]] inline unsigned mask_avx2(__m256i eq) noexcept { return unsigned(_mm256_movemask_epi8(eq)); }
+
+            template <class T>
+            [[gnu::target("avx2,popcnt")]] size_t mismatch_avx2(const T* a, const T* b, size_t n) noexcept {
+                constexpr size_t lanes = 32 / sizeof(T);
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    unsigned m = mask_avx2(eq_avx2<T>(load_avx2(a + i), load_avx2(b + i)));
+                    if (m != 0xFFFFFFFF)
+                        return i + countr_zero(~m) / sizeof(T);
+                }
+                return i + mismatch_scalar(a + i, b + i, n - i);
+            }
+            template <class T>
+            [[gnu::target("avx2,popcnt")]] size_t find_avx2(const T* p, size_t n, T val) noexcept {
+                constexpr size_t lanes = 32 / sizeof(T);
+                __m256i v = set1_avx2(val);
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    if (unsigned m = mask_avx2(eq_avx2<T>(load_avx2(p + i), v)))
+                        return i + countr_zero(m) / sizeof(T);
+                }
+                return i + find_scalar(p + i, n - i, val);
+            }
+            template <class T>
+            [[gnu::target("avx2,popcnt")]] size_t count_avx2(const T* p, size_t n, T val) noexcept {
+                constexpr size_t lanes = 32 / sizeof(T);
+                __m256i v = set1_avx2(val);
+                size_t bits = 0, i = 0;
+                for (; i + lanes <= n; i += lanes)
+                    bits += popcount(mask_avx2(eq_avx2<T>(load_avx2(p + i), v)));
+                return bits / sizeof(T) + count_scalar(p + i, n - i, val);
+            }
+            template <class T>
+            [[gnu::target("avx2,popcnt")]] void fill_avx2(T* p, size_t n, T val) noexcept {
+                constexpr size_t lanes = 32 / sizeof(T);
+                __m256i v = set1_avx2(val);
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes)
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), v);
+                fill_scalar(p + i, n - i, val);
+            }
+#endif
+
+            inline Isa detect_isa() noexcept {
+#if defined(MY_CONTAINER_SIMD_X86)
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2"))
+                    return Isa::avx2;
+                return Isa::sse2;
+#else
+                return Isa::scalar;
+#endif
+            }
+            inline Isa& active_isa() noexcept {
+                static Isa isa = detect_isa();
+                return isa;
+            }
+        }
+
+        inline Isa isa() noexcept { return detail::active_isa(); }
+        // Ограничивает набор инструкций сверху (для тестов и бенчмарков);
+        // выше возможностей процессора подняться нельзя.
+        inline void limit_isa(Isa max_isa) noexcept { detail::active_isa() = min(detail::detect_isa(), max_isa); }
+
+        // Индекс первого i, где !(a[i] == b[i]), или n.
+        template <vectorizable T>
+        size_t mismatch(const T* a, const T* b, size_t n) noexcept {
+#if defined(MY_CONTAINER_SIMD_X86)
+            switch (isa()) {
+            case Isa::avx2: return detail::mismatch_avx2(a, b, n);
+            case Isa::sse2: return detail::mismatch_sse2(a, b, n);
+            default: break;
+            }
+#endif
+            return detail::mismatch_scalar(a, b, n);
+        }
+        template <vectorizable T>
+        size_t find(const T* p, size_t n, T val) noexcept {
+#if defined(MY_CONTAINER_SIMD_X86)
+            switch (isa()) {
+            case Isa::avx2: return detail::find_avx2(p, n, val);
+            case Isa::sse2: return detail::find_sse2(p, n, val);
+            default: break;
+            }
+#endif
+            return detail::find_scalar(p, n, val);
+        }
+        template <vectorizable T>
+        size_t count(const T* p, size_t n, T val) noexcept {
+#if defined(MY_CONTAINER_SIMD_X86)
+            switch (isa()) {
+            case Isa::avx2: return detail::count_avx2(p, n, val);
+            case Isa::sse2: return detail::count_sse2(p, n, val);
+            default: break;
+            }
+#endif
+            return detail::count_scalar(p, n, val);
+        }
+        template <vectorizable T>
+        void fill(T* p, size_t n, T val) noexcept {
+#if defined(MY_CONTAINER_SIMD_X86)
+            switch (isa()) {
+            case Isa::avx2: return detail::fill_avx2(p, n, val);
+            case Isa::sse2: return detail::fill_sse2(p, n, val);
+            default: break;
+            }
+#endif
+            detail::fill_scalar(p, n, val);
+        }
+    }
+
+    // Тип можно переносить побайтовым копированием без вызова конструктора
+    // перемещения и деструктора источника. Для своих типов (например, владеющих
+    // указателем без ссылок на себя) допускается специализация.
+    template <class T>
+    struct is_trivially_relocatable : bool_constant<is_trivially_copyable_v<T>> {};
+
     template <class T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    // Однопроходный итератор: диапазон нельзя обойти дважды, чтобы узнать длину.
+    // Учитывается только явно объявленная категория: для типов без неё
+    // iterator_traits сам выводит input_iterator_tag.
+    template <class It>
+    concept single_pass_iterator = requires { typename It::iterator_category; } &&
+        !derived_from<typename It::iterator_category, forward_iterator_tag>;
+
+    // Непрерывный диапазон элементов T: его можно копировать через memcpy.
+    template <class It, class T>
+    concept contiguous_iterator_of = contiguous_iterator<It> && same_as<iter_value_t<It>, T>;
+
+    template <class T, class Alloc = allocator<T>, class Growth = DoubleGrowth>
     class Vector : public Container<T> {
     private:
 
+        using alloc_traits = allocator_traits<Alloc>;
+        static_assert(is_same_v<typename alloc_traits::value_type, T>, "Vector allocator must allocate T");
+        static_assert(is_same_v<typename alloc_traits::pointer, T*>, "Vector supports only raw allocator pointers");
+        static constexpr bool propagate_copy = alloc_traits::propagate_on_container_copy_assignment::value;
+        static constexpr bool propagate_move = alloc_traits::propagate_on_container_move_assignment::value;
+        static constexpr bool propagate_swap = alloc_traits::propagate_on_container_swap::value;
+
+        static constexpr bool trivial_copy = is_trivially_copyable_v<T>;
+        static constexpr bool trivial_relocate = is_trivially_relocatable_v<T>;
+
+        [[no_unique_address]] Alloc alloc_;
         T* data_ = NULL;
         size_t size_ = 0;
         size_t capacity_ = 0;
+        // Встроенный буфер SmallVector; у обычного Vector пуст.
+        T* inline_ = nullptr;
+        size_t inline_capacity_ = 0;
+
+        bool is_inline() const noexcept { return inline_ && data_ == inline_; }
+        T* allocate(size_t cnt) {
+            if (inline_ && data_ != inline_ && cnt <= inline_capacity_)
+                return inline_;
+            if (!cnt)
+                return nullptr;
+            return alloc_traits::allocate(alloc_, cnt);
+        }
+        void deallocate(T* ptr, size_t cnt) noexcept {
+            if (ptr && ptr != inline_)
+                alloc_traits::deallocate(alloc_, ptr, cnt);
+        }
+        // Освобождает текущий буфер (элементы уже разрушены или перенесены)
+        // и переходит на new_data_.
+        void replace_storage(T* new_data_, size_t new_capacity) noexcept {
+            deallocate(data_, capacity_);
+            data_ = new_data_;
+            capacity_ = inline_ && new_data_ == inline_ ? inline_capacity_ : new_capacity;
+        }
+        void reset_storage() noexcept {
+            data_ = inline_;
+            size_ = 0;
+            capacity_ = inline_capacity_;
+        }
+        // Забирает буфер v, если он в куче и память можно вернуть нашим
+        // аллокатором; иначе переносит элементы поштучно.
+        void move_from(Vector& v) {
+            if (!v.is_inline() && alloc_ == v.alloc_) {
+                destroy(data_, data_ + size_);
+                deallocate(data_, capacity_);
+                data_ = v.data_;
+                size_ = v.size_;
+                capacity_ = v.capacity_;
+                v.reset_storage();
+                return;
+            }
+            clear();
+            reserve(v.size_);
+            if constexpr (trivial_relocate)
+                copy_bytes(data_, v.data_, v.size_);
+            else {
+                construct_move(v.data_, v.data_ + v.size_, data_);
+                v.destroy(v.data_, v.data_ + v.size_);
+            }
+            size_ = v.size_;
+            v.size_ = 0;
+        }
+        // Обмен содержимым без обмена аллокаторами.
+        void swap_storage(Vector& v) {
+            if (!is_inline() && !v.is_inline() && alloc_ == v.alloc_) {
+                std::swap(data_, v.data_);
+                std::swap(size_, v.size_);
+                std::swap(capacity_, v.capacity_);
+                return;
+            }
+            Vector& a = size_ <= v.size_ ? *this : v;
+            Vector& b = size_ <= v.size_ ? v : *this;
+            a.reserve(b.size_);
+            size_t common = a.size_;
+            if constexpr (trivial_relocate) {
+                auto a_bytes = reinterpret_cast<unsigned char*>(a.data_);
+                swap_ranges(a_bytes, a_bytes + common * sizeof(T), reinterpret_cast<unsigned char*>(b.data_));
+                copy_bytes(a.data_ + common, b.data_ + common, b.size_ - common);
+            }
+            else {
+                for (size_t i = 0; i < common; i++)
+                    std::swap(a.data_[i], b.data_[i]);
+                a.construct_move(b.data_ + common, b.data_ + b.size_, a.data_ + common);
+                b.destroy(b.data_ + common, b.data_ + b.size_);
+            }
+            std::swap(a.size_, b.size_);
+        }
+        // Копирует cnt элементов src вместо текущих со строгой гарантией:
+        // старый буфер переиспользуется, только если копирование не бросает,
+        // иначе копия строится в новом буфере и подменяет старый.
+        // Исключение — SmallVector, который уже во встроенном буфере и чья
+        // копия в него помещается: второго встроенного буфера нет, а уходить
+        // ради копии в кучу нельзя, поэтому копирование идёт на месте с
+        // базовой гарантией.
+        void assign_copy(const T* src, size_t cnt) {
+            constexpr bool nothrow_copy = is_nothrow_copy_constructible_v<T> && is_nothrow_copy_assignable_v<T>;
+            if (nothrow_copy || (is_inline() && cnt <= inline_capacity_)) {
+                if (cnt <= capacity_) {
+                    if constexpr (trivial_copy)
+                        copy_bytes(data_, src, cnt);
+                    else {
+                        size_t common = min(cnt, size_);
+                        copy(src, src + common, data_);
+                        if (cnt > size_)
+                            construct_copy(src + common, src + cnt, data_ + size_);
+                        else
+                            destroy(data_ + cnt, data_ + size_);
+                    }
+                    size_ = cnt;
+                    return;
+                }
+            }
+            T* new_data_ = allocate(cnt);
+            try { construct_copy(src, src + cnt, new_data_); }
+            catch (...) {
+                deallocate(new_data_, cnt);
+                throw;
+            }
+            destroy(data_, data_ + size_);
+            replace_storage(new_data_, cnt);
+            size_ = cnt;
+        }
+        void destroy(T* first, T* last) noexcept {
+            if constexpr (!is_trivially_destructible_v<T>) {
+                for (; first != last; ++first)
+                    alloc_traits::destroy(alloc_, first);
+            }
+        }
+        static void copy_bytes(T* dest, const T* src, size_t cnt) noexcept {
+            if (cnt)
+                memcpy(static_cast<void*>(dest), static_cast<const void*>(src), cnt * sizeof(T));
+        }
+        static void move_bytes(T* dest, const T* src, size_t cnt) noexcept {
+            if (cnt)
+                memmove(static_cast<void*>(dest), static_cast<const void*>(src), cnt * sizeof(T));
+        }
+        // Конструирует в сырой памяти dest копии [first, last); при исключении
+        // уже построенные элементы разрушаются.
+        template <class InputIt>
+        void construct_copy(InputIt first, InputIt last, T* dest) {
+            if constexpr (trivial_copy && contiguous_iterator_of<InputIt, T>) {
+                copy_bytes(dest, to_address(first), last - first);
+                return;
+            }
+            T* cur = dest;
+            try {
+                for (; first != last; ++first, ++cur)
+                    alloc_traits::construct(alloc_, cur, *first);
+            }
+            catch (...) {
+                destroy(dest, cur);
+                throw;
+            }
+        }
+        template <class... Args>
+        void construct_fill(T* dest, size_t cnt, const Args&... args) {
+            if constexpr (simd::vectorizable<T> && sizeof...(Args) <= 1) {
+                simd::fill(dest, cnt, T(args...));
+                return;
+            }
+            size_t i = 0;
+            try {
+                for (; i < cnt; i++)
+                    alloc_traits::construct(alloc_, dest + i, args...);
+            }
+            catch (...) {
+                destroy(dest, dest + i);
+                throw;
+            }
+        }
+        // Конструирует [first, last) в сырой памяти dest: перемещает, если
+        // перемещение T не бросает, иначе копирует. Источник остаётся живым.
+        void construct_move(T* first, T* last, T* dest) {
+            T* cur = dest;
+            try {
+                for (; first != last; ++first, ++cur)
+                    alloc_traits::construct(alloc_, cur, move_if_noexcept(*first));
+            }
+            catch (...) {
+                destroy(dest, cur);
+                throw;
+            }
+        }
         void reallocate(size_t new_capacity) {
             if (new_capacity > this->max_size())
                 throw length_error("Vector capacity exceeds max size");
-            T* new_data_;
-            try { new_data_ = new T[new_capacity]; }
-            catch (const bad_alloc&) { throw bad_alloc(); }
-            capacity_ = new_capacity;
-            for (size_t i = 0; i < size_; i++)
-                new_data_[i] = data_[i];
-            if (data_)
-                delete[] data_;
-            data_ = new_data_;
+            T* new_data_ = allocate(new_capacity);
+            if constexpr (trivial_relocate)
+                copy_bytes(new_data_, data_, size_);
+            else {
+                try { construct_move(data_, data_ + size_, new_data_); }
+                catch (...) {
+                    deallocate(new_data_, new_capacity);
+                    throw;
+                }
+                destroy(data_, data_ + size_);
+            }
+            replace_storage(new_data_, new_capacity);
+        }
+        // Ёмкость для вставки ещё extra элементов: по стратегии роста, но не
+        // меньше требуемой.
+        size_t grow_capacity(size_t extra) const {
+            if (extra > this->max_size() - size_)
+                throw length_error("Vector capacity exceeds max size");
+            size_t new_capacity = Growth::next(capacity_, sizeof(T));
+            if (new_capacity <= capacity_ || new_capacity > this->max_size())
+                new_capacity = size_ + extra;
+            return max(new_capacity, size_ + extra);
+        }
+        // Переезд в новый буфер с дырой из cnt элементов в позиции index,
+        // которую заполняет construct_gap(slot). Дыра заполняется до переноса
+        // старых элементов, поэтому источник может ссылаться на сам вектор.
+        template <class ConstructGap>
+        [[gnu::noinline]] void realloc_gap(size_t index, size_t cnt, size_t new_capacity, ConstructGap construct_gap) {
+            T* new_data_ = allocate(new_capacity);
+            T* slot = new_data_ + index;
+            try {
+                construct_gap(slot);
+                if constexpr (!trivial_relocate) {
+                    try {
+                        construct_move(data_, data_ + index, new_data_);
+                        try { construct_move(data_ + index, data_ + size_, slot + cnt); }
+                        catch (...) {
+                            destroy(new_data_, slot);
+                            throw;
+                        }
+                    }
+                    catch (...) {
+                        destroy(slot, slot + cnt);
+                        throw;
+                    }
+                }
+            }
+            catch (...) {
+                deallocate(new_data_, new_capacity);
+                throw;
+            }
+            if constexpr (trivial_relocate) {
+                copy_bytes(new_data_, data_, index);
+                copy_bytes(slot + cnt, data_ + index, size_ - index);
+            }
+            else
+                destroy(data_, data_ + size_);
+            replace_storage(new_data_, new_capacity);
+            size_ += cnt;
+        }
+        template <class... Args>
+        void realloc_insert(size_t index, Args&&... args) {
+            realloc_gap(index, 1, grow_capacity(1), [&](T* slot) {
+                alloc_traits::construct(alloc_, slot, forward<Args>(args)...);
+            });
+        }
+        // Рост до cnt элементов, построенных из args. Новые элементы строятся
+        // до переноса старых, поэтому args может ссылаться на сам вектор, а
+        // при исключении вектор не меняется.
+        template <class... Args>
+        void resize_with(size_t cnt, const Args&... args) {
+            if (cnt <= size_) {
+                destroy(data_ + cnt, data_ + size_);
+                size_ = cnt;
+            }
+            else if (cnt <= capacity_) {
+                construct_fill(data_ + size_, cnt - size_, args...);
+                size_ = cnt;
+            }
+            else {
+                if (cnt > this->max_size())
+                    throw length_error("Vector capacity exceeds max size");
+                realloc_gap(size_, cnt - size_, cnt, [&](T* slot) { construct_fill(slot, cnt - size_, args...); });
+            }
+        }
+        template <class It>
+        static size_t range_size(It first, It last) {
+            if constexpr (requires { last - first; })
+                return size_t(last - first);
+            else {
+                size_t cnt = 0;
+                for (; first != last; ++first)
+                    cnt++;
+                return cnt;
+            }
+        }
+        // Вставка cnt элементов [first, last) в позицию index: не больше одного
+        // выделения памяти и один сдвиг хвоста.
+        template <class ForwardIt>
+        void insert_range(size_t index, ForwardIt first, ForwardIt last, size_t cnt) {
+            if (!cnt)
+                return;
+            if (cnt > capacity_ - size_) {
+                realloc_gap(index, cnt, grow_capacity(cnt), [&](T* slot) { construct_copy(first, last, slot); });
+                return;
+            }
+            T* pos = data_ + index;
+            T* old_end = data_ + size_;
+            size_t elems_after = size_ - index;
+            if constexpr (trivial_relocate) {
+                move_bytes(pos + cnt, pos, elems_after);
+                try { construct_copy(first, last, pos); }
+                catch (...) {
+                    move_bytes(pos, pos + cnt, elems_after);
+                    throw;
+                }
+                size_ += cnt;
+            }
+            else if (elems_after > cnt) {
+                construct_move(old_end - cnt, old_end, old_end);
+                size_ += cnt;
+                move_backward(pos, old_end - cnt, old_end);
+                for (; first != last; ++first, ++pos)
+                    *pos = *first;
+            }
+            else {
+                ForwardIt mid = first;
+                for (size_t i = 0; i < elems_after; i++)
+                    ++mid;
+                construct_copy(mid, last, old_end);
+                size_ += cnt - elems_after;
+                construct_move(pos, old_end, pos + cnt);
+                size_ += elems_after;
+                for (; first != mid; ++first, ++pos)
+                    *pos = *first;
+            }
+        }
+        // Итератор по cnt копиям одного значения для insert(pos, cnt, val).
+        struct FillIterator {
+            const T* val;
+            size_t pos;
+            const T& operator*() const { return *val; }
+            FillIterator& operator++() {
+                pos++;
+                return *this;
+            }
+            bool operator!=(const FillIterator& other) const { return pos != other.pos; }
+        };
+        void erase_at(size_t index) {
+            if constexpr (trivial_relocate) {
+                alloc_traits::destroy(alloc_, data_ + index);
+                move_bytes(data_ + index, data_ + index + 1, size_ - index - 1);
+            }
+            else {
+                move(data_ + index + 1, data_ + size_, data_ + index);
+                alloc_traits::destroy(alloc_, data_ + size_ - 1);
+            }
+            size_--;
         }
 
     public:
 
+        // Непрерывный итератор произвольного доступа: подходит для алгоритмов
+        // стандартной библиотеки, в том числе с политиками выполнения.
         template <class IterType>
         class Iterator {
 
         protected:
             friend class Vector;
+            template <class>
+            friend class Iterator;
             IterType* ptr = nullptr;
             Iterator(IterType* ptr) : ptr(ptr) {}
 
         public:
+            using iterator_category = random_access_iterator_tag;
+            using iterator_concept = contiguous_iterator_tag;
+            using value_type = remove_cv_t<IterType>;
+            using difference_type = ptrdiff_t;
+            using pointer = IterType*;
+            using reference = IterType&;
+
+            Iterator() = default;
             Iterator& operator=(const Iterator& other) = default;
             Iterator(const Iterator& other) = default;
             Iterator(Iterator&& other) = default;
+            // iterator неявно приводится к const_iterator.
+            template <class Other>
+                requires (is_const_v<IterType> && is_same_v<Other, remove_const_t<IterType>>)
+            Iterator(const Iterator<Other>& other) : ptr(other.ptr) {}
             Iterator& operator++() {
                 this->ptr++;
                 return *this;
@@ -91,13 +993,23 @@ namespace my_container {
                 --this->ptr;
                 return tmp;
             }
-            Iterator operator+(int n) const { return Iterator(this->ptr + n); }
-            Iterator operator-(int n) const { return Iterator(this->ptr - n); }
-            size_t operator-(const Iterator& i) const { return this->ptr - i.ptr; }
+            Iterator& operator+=(difference_type n) {
+                this->ptr += n;
+                return *this;
+            }
+            Iterator& operator-=(difference_type n) {
+                this->ptr -= n;
+                return *this;
+            }
+            Iterator operator+(difference_type n) const { return Iterator(this->ptr + n); }
+            friend Iterator operator+(difference_type n, const Iterator& i) { return Iterator(i.ptr + n); }
+            Iterator operator-(difference_type n) const { return Iterator(this->ptr - n); }
+            difference_type operator-(const Iterator& i) const { return this->ptr - i.ptr; }
             bool operator==(const Iterator& other) const { return this->ptr == other.ptr; }
-            bool operator<(const Iterator& other) const { return this->ptr < other.ptr; }
-            bool operator!=(const Iterator& other) const { return !(*this == other); }
-            IterType& operator*() { return *this->ptr; }
+            strong_ordering operator<=>(const Iterator& other) const { return this->ptr <=> other.ptr; }
+            reference operator*() const { return *this->ptr; }
+            pointer operator->() const { return this->ptr; }
+            reference operator[](difference_type n) const { return this->ptr[n]; }
         };
 
         using iterator = Iterator<T>;
@@ -109,29 +1021,30 @@ namespace my_container {
         using typename Container<T>::pointer;
         using typename Container<T>::const_pointer;
 
+        using allocator_type = Alloc;
+
         Vector() = default;
-        Vector(initializer_list<T> init) {
+        explicit Vector(const Alloc& alloc) noexcept : alloc_(alloc) {}
+        Vector(initializer_list<T> init, const Alloc& alloc = Alloc()) : Vector(alloc) {
             reserve(init.size());
-            for (const auto& item : init)
-                data_[size_++] = item;
+            construct_copy(init.begin(), init.end(), data_);
+            size_ = init.size();
         }
-        Vector(size_type cnt, const_reference val) {
+        Vector(size_type cnt, const_reference val, const Alloc& alloc = Alloc()) : Vector(alloc) {
             reserve(cnt);
+            construct_fill(data_, cnt, val);
             size_ = cnt;
-            for (size_type i = 0; i < size_; i++)
-                data_[i] = val;
         }
-        Vector(const Vector& v) {
+        Vector(const Vector& v, const Alloc& alloc) : Vector(alloc) {
             reserve(v.size_);
-            for (size_type i = 0; i < v.size_; i++)
-                data_[i] = v.data_[i];
+            construct_copy(v.data_, v.data_ + v.size_, data_);
             size_ = v.size_;
         }
-        Vector(Vector&& v) noexcept : data_(v.data_), size_(v.size_), capacity_(v.capacity_) {
-            v.data_ = nullptr;
-            v.size_ = 0;
-            v.capacity_ = 0;
-        }
+        Vector(const Vector& v) : Vector(v, alloc_traits::select_on_container_copy_construction(v.alloc_)) {}
+        // Из встроенного буфера SmallVector элементы переносятся поштучно,
+        // и нехватка памяти здесь приводит к terminate.
+        Vector(Vector&& v) noexcept : Vector(v.alloc_) { move_from(v); }
+        Vector(Vector&& v, const Alloc& alloc) : Vector(alloc) { move_from(v); }
         void print() const noexcept {
             cout << "Size = " << size_ << ", capacity = " << capacity_ << '\n';
             for (size_type i = 0; i < size_; i++)
@@ -139,19 +1052,43 @@ namespace my_container {
             cout << "|\n";
         }
 
+        // Строгая гарантия: при исключении вектор не меняется.
         Vector& operator=(const Vector& v) {
-            if (*this != v) {
-                Vector tmp(v);
-                this->swap(tmp);
+            if (this == &v)
+                return *this;
+            if constexpr (propagate_copy) {
+                if (alloc_ != v.alloc_) {
+                    Vector tmp(v, v.alloc_);
+                    destroy(data_, data_ + size_);
+                    deallocate(data_, capacity_);
+                    alloc_ = v.alloc_;
+                    data_ = tmp.data_;
+                    size_ = tmp.size_;
+                    capacity_ = tmp.capacity_;
+                    tmp.reset_storage();
+                    return *this;
+                }
             }
+            this->assign_copy(v.data_, v.size_);
+            return *this;
+        }
+        Vector& operator=(Vector&& v) noexcept(propagate_move || alloc_traits::is_always_equal::value) {
+            if (this == &v)
+                return *this;
+            if constexpr (propagate_move) {
+                if (alloc_ != v.alloc_) {
+                    clear();
+                    deallocate(data_, capacity_);
+                    reset_storage();
+                }
+                alloc_ = v.alloc_;
+            }
+            move_from(v);
             return *this;
         }
         ~Vector() {
-            size_ = 0;
-            capacity_ = 0;
-            if (data_)
-                delete[] data_;
-            data_ = NULL;
+            destroy(data_, data_ + size_);
+            deallocate(data_, capacity_);
         }
 
         reference operator[](size_type pos) { return data_[pos]; }
@@ -175,7 +1112,10 @@ namespace my_container {
 
         bool empty() const noexcept override final { return !size_; }
         size_type size() const noexcept override final { return size_; }
-        size_type max_size() const noexcept override final { return (size_type)(-1) / sizeof(T); }
+        size_type max_size() const noexcept override final {
+            return min<size_type>((size_type)(-1) / sizeof(T), alloc_traits::max_size(alloc_));
+        }
+        allocator_type get_allocator() const noexcept { return alloc_; }
         size_type capacity() const { return capacity_; }
         void reserve(size_type new_capacity) {
             if (new_capacity > this->max_size())
@@ -184,119 +1124,167 @@ namespace my_container {
                 reallocate(new_capacity);
         }
         void shrink_to_fit() {
-            if (size_ < capacity_)
+            if (size_ < capacity_ && !is_inline())
                 this->reallocate(size_);
         }
 
         void clear() {
-            for (size_type i = 0; i < size_; i++)
-                data_[i].~T();
+            destroy(data_, data_ + size_);
             size_ = 0;
         }
-        void push_back(const_reference val) {
-            if (size_ == capacity_) {
-                if (!capacity_)
-                    this->reallocate(2);
-                else
-                    this->reallocate(2 * capacity_);
-            }
-            data_[size_++] = val;
-        }
-        void push_back(T&& val) {
-            if (size_ == capacity_) {
-                if (!capacity_)
-                    this->reallocate(2);
-                else
-                    this->reallocate(2 * capacity_);
+        template <class... Args>
+        reference emplace_back(Args&&... args) {
+            if (size_ != capacity_) [[likely]]
+                alloc_traits::construct(alloc_, data_ + size_, forward<Args>(args)...);
+            else {
+                this->realloc_insert(size_, forward<Args>(args)...);
+                return data_[size_ - 1];
             }
-            data_[size_++] = move(val);
+            return data_[size_++];
         }
+        void push_back(const_reference val) { this->emplace_back(val); }
+        void push_back(T&& val) { this->emplace_back(move(val)); }
         void pop_back() {
             if (size_) {
-                data_[size_ - 1].~T();
+                alloc_traits::destroy(alloc_, data_ + size_ - 1);
                 size_--;
             }
         }
-        void resize(size_type cnt) {
-            if (cnt > size_)
-                reserve(cnt);
-            else {
-                for (size_type i = cnt; i < size_; i++)
-                    data_[i].~T();
+        void resize(size_type cnt) { this->resize_with(cnt); }
+        void resize(size_type cnt, const_reference val) { this->resize_with(cnt, val); }
+        // Не noexcept: если один из векторов во встроенном буфере SmallVector
+        // или аллокаторы различны и не обмениваются, элементы обмениваются
+        // поштучно и короткому может понадобиться память.
+        void swap(Vector& v) {
+            if (this == &v)
+                return;
+            if constexpr (propagate_swap) {
+                if (!is_inline() && !v.is_inline()) {
+                    std::swap(alloc_, v.alloc_);
+                    std::swap(data_, v.data_);
+                    std::swap(size_, v.size_);
+                    std::swap(capacity_, v.capacity_);
+                    return;
+                }
             }
-            size_ = cnt;
+            this->swap_storage(v);
         }
-        void resize(size_type cnt, const_reference val) {
-            if (cnt > size_) {
-                reserve(cnt);
-                for (size_type i = size_; i < cnt; i++)
-                    data_[i] = val;
+        template <class... Args>
+        iterator emplace(const_iterator pos, Args&&... args) {
+            size_type index = pos - this->cbegin();
+            if (size_ == capacity_)
+                this->realloc_insert(index, forward<Args>(args)...);
+            else if (index == size_) {
+                alloc_traits::construct(alloc_, data_ + size_, forward<Args>(args)...);
+                size_++;
+            }
+            else if constexpr (trivial_relocate) {
+                // Элемент строится во временном буфере до сдвига хвоста
+                // (args может ссылаться на сам вектор) и переносится байтами.
+                alignas(T) unsigned char buf[sizeof(T)];
+                T* tmp = reinterpret_cast<T*>(buf);
+                alloc_traits::construct(alloc_, tmp, forward<Args>(args)...);
+                move_bytes(data_ + index + 1, data_ + index, size_ - index);
+                copy_bytes(data_ + index, tmp, 1);
+                size_++;
             }
             else {
-                for (size_type i = cnt; i < size_; i++)
-                    data_[i].~T();
+                value_type tmp(forward<Args>(args)...);
+                alloc_traits::construct(alloc_, data_ + size_, move(data_[size_ - 1]));
+                size_++;
+                move_backward(data_ + index, data_ + size_ - 2, data_ + size_ - 1);
+                data_[index] = move(tmp);
             }
-            size_ = cnt;
-        }
-        void swap(Vector& v) noexcept {
-            std::swap(data_, v.data_);
-            std::swap(size_, v.size_);
-            std::swap(capacity_, v.capacity_);
+            return iterator(data_ + index);
         }
-        iterator insert(const_iterator pos, const_reference val) {
+        iterator insert(const_iterator pos, const_reference val) { return this->emplace(pos, val); }
+        iterator insert(const_iterator pos, T&& val) { return this->emplace(pos, move(val)); }
+        iterator insert(const_iterator pos, size_type cnt, const_reference val) {
             size_type index = pos - this->cbegin();
-            if (size_ == capacity_) {
-                if (!capacity_)
-                    this->reallocate(2);
-                else
-                    this->reallocate(2 * capacity_);
+            if (cnt) {
+                value_type tmp(val);
+                this->insert_range(index, FillIterator{ &tmp, 0 }, FillIterator{ &tmp, cnt }, cnt);
             }
-            for (size_type i = size_; i > index; i--)
-                data_[i] = move(data_[i - 1]);
-            data_[index] = val;
-            size_++;
             return iterator(data_ + index);
         }
-        iterator insert(const_iterator pos, size_type cnt, const_reference val) {
+        template <class InputIt>
+            requires (!is_integral_v<InputIt>)
+        iterator insert(const_iterator pos, InputIt first, InputIt last) {
             size_type index = pos - this->cbegin();
-            for (size_type i = 0; i < cnt; i++) {
-                this->insert(pos, val);
-                pos = this->cbegin() + index;
+            if constexpr (single_pass_iterator<InputIt>) {
+                Vector tmp(alloc_);
+                for (; first != last; ++first)
+                    tmp.emplace_back(*first);
+                this->insert_range(index, make_move_iterator(tmp.data_),
+                    make_move_iterator(tmp.data_ + tmp.size_), tmp.size_);
             }
+            else
+                this->insert_range(index, first, last, range_size(first, last));
             return iterator(data_ + index);
         }
+        iterator insert(const_iterator pos, initializer_list<T> init) {
+            return this->insert(pos, init.begin(), init.end());
+        }
+        template <class Range>
+        void append_range(Range&& range) {
+            this->insert(this->cend(), std::begin(range), std::end(range));
+        }
         iterator erase(iterator pos) {
             size_type index = pos - this->begin();
-            data_[index].~T();
-            for (size_type i = index; i < size_ - 1; i++)
-                data_[i] = move(data_[i + 1]);
-            size_--;
+            this->erase_at(index);
             return iterator(data_ + index);
         }
         iterator erase(iterator first, iterator last) {
-            size_type diff = last - first;
-            for (size_type i = 0; i < diff; i++)
-                this->erase(first);
-            return last;
+            return this->erase(const_iterator(first), const_iterator(last));
         }
         iterator erase(const_iterator pos) {
             size_type index = pos - this->cbegin();
-            data_[index].~T();
-            for (size_type i = index; i < size_ - 1; i++)
-                data_[i] = move(data_[i + 1]);
-            size_--;
+            this->erase_at(index);
             return iterator(data_ + index);
         }
         iterator erase(const_iterator first, const_iterator last) {
-            size_type diff = last - first;
-            for (size_type i = 0; i < diff; i++)
-                this->erase(first);
-            return iterator((T*)last.ptr);
+            size_type index = first - this->cbegin();
+            size_type cnt = last - first;
+            if (cnt) {
+                T* pos = data_ + index;
+                if constexpr (trivial_relocate) {
+                    destroy(pos, pos + cnt);
+                    move_bytes(pos, pos + cnt, size_ - index - cnt);
+                }
+                else {
+                    move(pos + cnt, data_ + size_, pos);
+                    destroy(data_ + size_ - cnt, data_ + size_);
+                }
+                size_ -= cnt;
+            }
+            return iterator(data_ + index);
+        }
+
+        iterator find(const_reference val) {
+            if constexpr (simd::vectorizable<T>)
+                return iterator(data_ + simd::find(data_, size_, val));
+            return iterator(std::find(data_, data_ + size_, val));
+        }
+        const_iterator find(const_reference val) const {
+            if constexpr (simd::vectorizable<T>)
+                return const_iterator(data_ + simd::find(data_, size_, val));
+            return const_iterator(std::find(data_, data_ + size_, val));
+        }
+        size_type count(const_reference val) const {
+            if constexpr (simd::vectorizable<T>)
+                return simd::count(data_, size_, val);
+            return std::count(data_, data_ + size_, val);
         }
 
-        auto operator<=>(const Vector& v) const {
+        compare_three_way_result_t<T> operator<=>(const Vector& v) const {
             if (this->size_ != v.size_)
                 return this->size_ <=> v.size_;
+            if constexpr (simd::vectorizable<T>) {
+                size_type i = simd::mismatch(data_, v.data_, size_);
+                if (i == size_)
+                    return strong_ordering::equal;
+                return data_[i] <=> v.data_[i];
+            }
             for (size_type i = 0; i < this->size_; i++) {
                 if (auto cmp = data_[i] <=> v.data_[i]; cmp != 0)
                     return cmp;
@@ -307,6 +1295,8 @@ namespace my_container {
             const Vector& v = dynamic_cast<const Vector&>(other);
             if (v.size() != this->size_)
                 return false;
+            if constexpr (simd::vectorizable<T>)
+                return simd::mismatch(data_, v.data_, size_) == size_;
             return (*this <=> v) == 0;
         }
         bool operator!=(const Container<T>& other) const override final {
@@ -319,8 +1309,320 @@ namespace my_container {
 
         iterator begin() noexcept { return iterator(data_); }
         iterator end() noexcept { return iterator(data_ + size_); }
+        const_iterator begin() const noexcept { return const_iterator(data_); }
+        const_iterator end() const noexcept { return const_iterator(data_ + size_); }
         const_iterator cbegin() const noexcept { return const_iterator(data_); }
         const_iterator cend() const noexcept { return const_iterator(data_ + size_); }
+
+    protected:
+
+        // Для SmallVector: начальный буфер лежит в объекте-наследнике.
+        Vector(T* inline_buffer, size_t inline_capacity, const Alloc& alloc) noexcept
+            : alloc_(alloc), data_(inline_buffer), capacity_(inline_capacity),
+            inline_(inline_buffer), inline_capacity_(inline_capacity) {}
+    };
+
+    // Vector, хранящий до N элементов внутри объекта и переходящий в кучу
+    // только при превышении N.
+    template <class T, size_t N, class Alloc = allocator<T>, class Growth = DoubleGrowth>
+    class SmallVector : public Vector<T, Alloc, Growth> {
+        static_assert(N > 0, "SmallVector needs a non-empty inline buffer");
+
+    private:
+
+        using base = Vector<T, Alloc, Growth>;
+
+        alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+    public:
+
+        using typename base::size_type;
+        using typename base::const_reference;
+
+        SmallVector() noexcept : SmallVector(Alloc()) {}
+        explicit SmallVector(const Alloc& alloc) noexcept : base(reinterpret_cast<T*>(buffer_), N, alloc) {}
+        SmallVector(initializer_list<T> init, const Alloc& alloc = Alloc()) : SmallVector(alloc) {
+            this->reserve(init.size());
+            this->insert(this->cend(), init);
+        }
+        SmallVector(size_type cnt, const_reference val, const Alloc& alloc = Alloc()) : SmallVector(alloc) {
+            this->resize(cnt, val);
+        }
+        SmallVector(const base& v) : SmallVector(v.get_allocator()) {
+            this->reserve(v.size());
+            this->insert(this->cend(), v.begin(), v.end());
+        }
+        SmallVector(const SmallVector& v) : SmallVector(static_cast<const base&>(v)) {}
+        SmallVector(base&& v) noexcept : SmallVector(v.get_allocator()) { base::operator=(move(v)); }
+        SmallVector(SmallVector&& v) noexcept : SmallVector(v.get_allocator()) { base::operator=(move(v)); }
+        ~SmallVector() { this->clear(); }
+
+        SmallVector& operator=(const SmallVector& v) {
+            base::operator=(v);
+            return *this;
+        }
+        SmallVector& operator=(SmallVector&& v) noexcept {
+            base::operator=(move(v));
+            return *this;
+        }
+
+        static constexpr size_type inline_capacity() noexcept { return N; }
+    };
+
+#if defined(__linux__)
+    // Vector для тривиально копируемых T, хранящий элементы в отображённом
+    // в память файле. Файл растёт через ftruncate + mremap, а повторное
+    // открытие лишь проверяет заголовок: данные не читаются и не разбираются,
+    // страницы подгружаются ядром по мере обращения.
+    template <class T, class Growth = DoubleGrowth>
+    class MappedVector : public Container<T> {
+        static_assert(is_trivially_copyable_v<T>, "MappedVector stores T as raw bytes");
+
+    private:
+
+        // Заголовок в начале файла; элементы идут сразу за ним.
+        struct Header {
+            uint64_t magic;
+            uint64_t elem_size;
+            uint64_t size;
+        };
+        static constexpr size_t header_size = 64;
+        static constexpr uint64_t file_magic = 0x31524556504d4d59ULL;
+        static_assert(alignof(T) <= header_size, "MappedVector element alignment exceeds header size");
+
+        int fd_ = -1;
+        unsigned char* map_ = nullptr;
+        size_t map_bytes_ = 0;
+        size_t size_ = 0;
+        size_t capacity_ = 0;
+
+        static void check(bool ok, const char* what) {
+            if (!ok)
+                throw system_error(errno, generic_category(), what);
+        }
+        Header& header() const noexcept { return *reinterpret_cast<Header*>(map_); }
+        T* elems() const noexcept { return reinterpret_cast<T*>(map_ + header_size); }
+        void set_size(size_t size) noexcept {
+            size_ = size;
+            header().size = size;
+        }
+        void close_file() noexcept {
+            if (map_)
+                ::munmap(map_, map_bytes_);
+            if (fd_ >= 0)
+                ::close(fd_);
+            fd_ = -1;
+            map_ = nullptr;
+            map_bytes_ = size_ = capacity_ = 0;
+        }
+        // Меняет длину файла и отображения; при росте файл удлиняется до
+        // mremap, при сжатии укорачивается после.
+        void remap(size_t new_capacity) {
+            size_t bytes = header_size + new_capacity * sizeof(T);
+            bool grow = bytes > map_bytes_;
+            if (grow)
+                check(::ftruncate(fd_, off_t(bytes)) == 0, "MappedVector: ftruncate");
+            void* p = ::mremap(map_, map_bytes_, bytes, MREMAP_MAYMOVE);
+            check(p != MAP_FAILED, "MappedVector: mremap");
+            map_ = static_cast<unsigned char*>(p);
+            map_bytes_ = bytes;
+            capacity_ = new_capacity;
+            if (!grow)
+                check(::ftruncate(fd_, off_t(bytes)) == 0, "MappedVector: ftruncate");
+        }
+        size_t grow_capacity(size_t extra) const {
+            if (extra > this->max_size() - size_)
+                throw length_error("MappedVector capacity exceeds max size");
+            size_t new_capacity = Growth::next(capacity_, sizeof(T));
+            if (new_capacity <= capacity_ || new_capacity > this->max_size())
+                new_capacity = size_ + extra;
+            return max(new_capacity, size_ + extra);
+        }
+
+    public:
+
+        using iterator = T*;
+        using const_iterator = const T*;
+        using typename Container<T>::value_type;
+        using typename Container<T>::size_type;
+        using typename Container<T>::reference;
+        using typename Container<T>::const_reference;
+        using typename Container<T>::pointer;
+        using typename Container<T>::const_pointer;
+
+        // Открывает файл path или создаёт пустой. Файл с чужим заголовком или
+        // другим размером элемента отвергается с runtime_error.
+        explicit MappedVector(const string& path) {
+            fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            check(fd_ >= 0, "MappedVector: open");
+            try {
+                struct stat st;
+                check(::fstat(fd_, &st) == 0, "MappedVector: fstat");
+                size_t bytes = size_t(st.st_size);
+                bool fresh = bytes == 0;
+                if (fresh) {
+                    bytes = header_size;
+                    check(::ftruncate(fd_, off_t(bytes)) == 0, "MappedVector: ftruncate");
+                }
+                else if (bytes < header_size || (bytes - header_size) % sizeof(T))
+                    throw runtime_error("MappedVector: " + path + " has an invalid length");
+                void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+                check(p != MAP_FAILED, "MappedVector: mmap");
+                map_ = static_cast<unsigned char*>(p);
+                map_bytes_ = bytes;
+                capacity_ = (bytes - header_size) / sizeof(T);
+                if (fresh)
+                    header() = Header{ file_magic, sizeof(T), 0 };
+                else if (header().magic != file_magic || header().elem_size != sizeof(T) || header().size > capacity_)
+                    throw runtime_error("MappedVector: " + path + " is not a MappedVector of this type");
+                size_ = header().size;
+            }
+            catch (...) {
+                close_file();
+                throw;
+            }
+        }
+        MappedVector(const MappedVector&) = delete;
+        MappedVector& operator=(const MappedVector&) = delete;
+        MappedVector(MappedVector&& v) noexcept
+            : fd_(exchange(v.fd_, -1)), map_(exchange(v.map_, nullptr)), map_bytes_(exchange(v.map_bytes_, 0)),
+            size_(exchange(v.size_, 0)), capacity_(exchange(v.capacity_, 0)) {}
+        MappedVector& operator=(MappedVector&& v) noexcept {
+            if (this != &v) {
+                close_file();
+                fd_ = exchange(v.fd_, -1);
+                map_ = exchange(v.map_, nullptr);
+                map_bytes_ = exchange(v.map_bytes_, 0);
+                size_ = exchange(v.size_, 0);
+                capacity_ = exchange(v.capacity_, 0);
+            }
+            return *this;
+        }
+        ~MappedVector() { close_file(); }
+
+        reference operator[](size_type pos) { return elems()[pos]; }
+        const_reference operator[](size_type pos) const { return elems()[pos]; }
+        reference at(size_type pos) {
+            if (pos >= size_)
+                throw out_of_range("Index out of range");
+            return elems()[pos];
+        }
+        const_reference at(size_type pos) const {
+            if (pos >= size_)
+                throw out_of_range("Index out of range");
+            return elems()[pos];
+        }
+        reference front() { return elems()[0]; }
+        const_reference front() const { return elems()[0]; }
+        reference back() { return elems()[size_ - 1]; }
+        const_reference back() const { return elems()[size_ - 1]; }
+        pointer data() { return elems(); }
+        const_pointer data() const { return elems(); }
+
+        bool empty() const noexcept override final { return !size_; }
+        size_type size() const noexcept override final { return size_; }
+        size_type max_size() const noexcept override final { return (size_type(-1) - header_size) / sizeof(T); }
+        size_type capacity() const { return capacity_; }
+        void reserve(size_type new_capacity) {
+            if (new_capacity > this->max_size())
+                throw length_error("MappedVector capacity exceeds max size");
+            if (new_capacity > capacity_)
+                remap(new_capacity);
+        }
+        void shrink_to_fit() {
+            if (size_ < capacity_)
+                remap(size_);
+        }
+        // Сбрасывает изменённые страницы на диск.
+        void sync() {
+            check(::msync(map_, map_bytes_, MS_SYNC) == 0, "MappedVector: msync");
+        }
+
+        void clear() noexcept { set_size(0); }
+        // При расширении mremap может перенести отображение, поэтому
+        // элемент сначала собирается во временной переменной: аргументы
+        // могут ссылаться на элементы этого же вектора.
+        template <class... Args>
+        reference emplace_back(Args&&... args) {
+            if (size_ == capacity_) {
+                T tmp(forward<Args>(args)...);
+                remap(grow_capacity(1));
+                T* slot = elems() + size_;
+                ::new (static_cast<void*>(slot)) T(tmp);
+                set_size(size_ + 1);
+                return *slot;
+            }
+            T* slot = elems() + size_;
+            ::new (static_cast<void*>(slot)) T(forward<Args>(args)...);
+            set_size(size_ + 1);
+            return *slot;
+        }
+        void push_back(const_reference val) { this->emplace_back(val); }
+        void pop_back() noexcept {
+            if (size_)
+                set_size(size_ - 1);
+        }
+        void resize(size_type cnt) { this->resize(cnt, T()); }
+        void resize(size_type cnt, const_reference val) {
+            if (cnt > size_) {
+                T tmp(val);
+                reserve(cnt);
+                if constexpr (simd::vectorizable<T>)
+                    simd::fill(elems() + size_, cnt - size_, tmp);
+                else
+                    uninitialized_fill(elems() + size_, elems() + cnt, tmp);
+            }
+            set_size(cnt);
+        }
+        // Дописывает диапазон в конец: непрерывный диапазон T копируется
+        // одним memcpy после единственного расширения файла.
+        template <class Range>
+        void append_range(Range&& range) {
+            auto first = std::begin(range);
+            auto last = std::end(range);
+            if constexpr (contiguous_iterator_of<decltype(first), T>) {
+                size_t cnt = size_t(last - first);
+                const T* src = to_address(first);
+                if (cnt > capacity_ - size_) {
+                    // Диапазон внутри самого вектора переедет вместе с
+                    // отображением: запоминаем смещение, а не адрес.
+                    const T* base = elems();
+                    less<const T*> before;
+                    bool inside = cnt && !before(src, base) && before(src, base + size_);
+                    size_t offset = inside ? size_t(src - base) : 0;
+                    remap(grow_capacity(cnt));
+                    if (inside)
+                        src = elems() + offset;
+                }
+                if (cnt)
+                    memcpy(static_cast<void*>(elems() + size_), src, cnt * sizeof(T));
+                set_size(size_ + cnt);
+            }
+            else {
+                for (; first != last; ++first)
+                    this->emplace_back(*first);
+            }
+        }
+
+        bool operator==(const Container<T>& other) const override final {
+            const MappedVector& v = dynamic_cast<const MappedVector&>(other);
+            if (v.size_ != size_)
+                return false;
+            if constexpr (simd::vectorizable<T>)
+                return simd::mismatch(elems(), v.elems(), size_) == size_;
+            return std::equal(begin(), end(), v.begin());
+        }
+        bool operator!=(const Container<T>& other) const override final {
+            return !(*this == other);
+        }
+
+        iterator begin() noexcept { return elems(); }
+        iterator end() noexcept { return elems() + size_; }
+        const_iterator begin() const noexcept { return elems(); }
+        const_iterator end() const noexcept { return elems() + size_; }
+        const_iterator cbegin() const noexcept { return elems(); }
+        const_iterator cend() const noexcept { return elems() + size_; }
     };
+#endif
 }
 #endif
\ No newline at end of file
@@ -2,9 +2,33 @@
 #include "my_lib.hpp"
 #include <exception>
 #include <iostream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <new>
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <ranges>
+#include <limits>
+#include <cstdio>
+#include <system_error>
 using namespace std;
 using namespace my_container;
 
+static size_t heap_allocations = 0;
+
+void* operator new(size_t n) {
+    heap_allocations++;
+    if (void* p = malloc(n ? n : 1))
+        return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
 TEST(VectorTest, test_init_list) {
     Vector<int> v{ 0, 1, 2 };
     ASSERT_EQ(v.size(), 3);
@@ -148,6 +172,698 @@ TEST(VectorTest, erase_test) {
     ASSERT_TRUE(c == a);
 }
 
+struct CopyCounter {
+    static inline int copies = 0;
+    static inline int moves = 0;
+    int val = 0;
+    CopyCounter(int val) : val(val) {}
+    CopyCounter(const CopyCounter& c) : val(c.val) { copies++; }
+    CopyCounter(CopyCounter&& c) noexcept : val(c.val) { moves++; }
+    CopyCounter& operator=(const CopyCounter& c) { val = c.val; copies++; return *this; }
+    CopyCounter& operator=(CopyCounter&& c) noexcept { val = c.val; moves++; return *this; }
+    auto operator<=>(const CopyCounter&) const = default;
+};
+
+TEST(VectorTest, growth_moves_test) {
+    Vector<CopyCounter> v;
+    CopyCounter::copies = 0;
+    CopyCounter::moves = 0;
+    for (int i = 0; i < 100; i++)
+        v.push_back(CopyCounter(i));
+    ASSERT_EQ(CopyCounter::copies, 0);
+    v.reserve(1000);
+    v.shrink_to_fit();
+    ASSERT_EQ(CopyCounter::copies, 0);
+    for (int i = 0; i < 100; i++)
+        ASSERT_EQ(v[i].val, i);
+}
+
+TEST(VectorTest, string_test) {
+    Vector<string> v;
+    for (int i = 0; i < 50; i++)
+        v.push_back(string(40, char('a' + i % 26)));
+    v.push_back(v[0]);
+    v.insert(v.cbegin() + 1, v[2]);
+    ASSERT_EQ(v.size(), 52);
+    ASSERT_EQ(v[1], v[3]);
+    ASSERT_EQ(v.back(), v.front());
+    v.erase(v.cbegin());
+    ASSERT_EQ(v[0], string(40, 'c'));
+    v.resize(60, v[0]);
+    ASSERT_EQ(v.back(), string(40, 'c'));
+    v.resize(70);
+    ASSERT_TRUE(v.back().empty());
+    Vector<string> copy(v);
+    ASSERT_TRUE(copy == v);
+}
+
+struct Point {
+    int x = 0;
+    string name;
+    Point(int x, string name) : x(x), name(move(name)) {}
+    auto operator<=>(const Point&) const = default;
+};
+
+TEST(VectorTest, emplace_test) {
+    Vector<Point> v;
+    Point& p = v.emplace_back(1, "one");
+    ASSERT_TRUE(p.x == 1 && p.name == "one");
+    v.emplace_back(3, "three");
+    auto it = v.emplace(v.cbegin() + 1, 2, "two");
+    ASSERT_EQ((*it).x, 2);
+    v.emplace(v.cbegin(), 0, "zero");
+    ASSERT_EQ(v.size(), 4);
+    for (int i = 0; i < 4; i++)
+        ASSERT_EQ(v[i].x, i);
+    ASSERT_EQ(v[3].name, "three");
+}
+
+TEST(VectorTest, growth_policy_test) {
+    Vector<int, allocator<int>, HalfGrowth> h;
+    Vector<int> d;
+    for (int i = 0; i < 7; i++) {
+        h.push_back(i);
+        d.push_back(i);
+    }
+    ASSERT_EQ(h.capacity(), 9);
+    ASSERT_EQ(d.capacity(), 8);
+
+    struct Big { char bytes[1000]; auto operator<=>(const Big&) const = default; };
+    Vector<Big, allocator<Big>, PageGrowth<>> p;
+    p.push_back(Big{});
+    ASSERT_EQ(p.capacity(), 4);
+    for (int i = 0; i < 4; i++)
+        p.push_back(Big{});
+    ASSERT_EQ(p.capacity(), 8);
+}
+
+TEST(VectorTest, range_insert_test) {
+    Vector<int> a{ 1, 5 };
+    int src[] = { 2, 3, 4 };
+    auto it = a.insert(a.cbegin() + 1, src, src + 3);
+    ASSERT_EQ(*it, 2);
+    ASSERT_TRUE(a == Vector<int>({ 1, 2, 3, 4, 5 }));
+    a.reserve(20);
+    a.insert(a.cbegin() + 4, { 7, 8 });
+    ASSERT_TRUE(a == Vector<int>({ 1, 2, 3, 4, 7, 8, 5 }));
+    Vector<int> b{ 0, 0 };
+    a.insert(a.cbegin(), b.begin(), b.end());
+    ASSERT_TRUE(a == Vector<int>({ 0, 0, 1, 2, 3, 4, 7, 8, 5 }));
+
+    istringstream in("10 20 30");
+    a.insert(a.cend(), istream_iterator<int>(in), istream_iterator<int>());
+    ASSERT_EQ(a.size(), 12);
+    ASSERT_EQ(a.back(), 30);
+}
+
+TEST(VectorTest, range_insert_strings_test) {
+    Vector<string> v{ "a", "b", "c", "d" };
+    v.reserve(16);
+    Vector<string> src{ "x", "y" };
+    v.insert(v.cbegin() + 1, src.begin(), src.end());
+    ASSERT_TRUE(v == Vector<string>({ "a", "x", "y", "b", "c", "d" }));
+    v.insert(v.cbegin() + 5, { "p", "q", "r" });
+    ASSERT_TRUE(v == Vector<string>({ "a", "x", "y", "b", "c", "p", "q", "r", "d" }));
+    v.insert(v.cbegin(), 3, v[8]);
+    ASSERT_TRUE(v[0] == "d" && v[2] == "d" && v[3] == "a" && v.size() == 12);
+    v.insert(v.cbegin() + 1, 20, v[3]);
+    ASSERT_TRUE(v[1] == "a" && v[20] == "a" && v[21] == "d" && v.size() == 32);
+}
+
+TEST(VectorTest, range_erase_test) {
+    Vector<string> v{ "a", "b", "c", "d", "e" };
+    auto it = v.erase(v.cbegin() + 1, v.cbegin() + 3);
+    ASSERT_EQ(*it, "d");
+    ASSERT_TRUE(v == Vector<string>({ "a", "d", "e" }));
+    v.erase(v.cbegin(), v.cbegin());
+    ASSERT_EQ(v.size(), 3);
+    v.erase(v.begin(), v.end());
+    ASSERT_TRUE(v.empty());
+
+    Vector<int> a{ 1, 2, 3, 4, 5 };
+    a.erase(a.begin() + 3, a.end());
+    ASSERT_TRUE(a == Vector<int>({ 1, 2, 3 }));
+}
+
+TEST(VectorTest, append_range_test) {
+    Vector<int> a{ 1, 2 };
+    const Vector<int> b{ 3, 4 };
+    a.append_range(b);
+    a.append_range(std::vector<int>{ 5, 6, 7 });
+    ASSERT_TRUE(a == Vector<int>({ 1, 2, 3, 4, 5, 6, 7 }));
+    ASSERT_EQ(a.capacity(), 8);
+}
+
+// Владеет памятью, но не ссылается на себя: переносится побайтово.
+struct Owner {
+    static inline int moves = 0;
+    int* p;
+    Owner(int v) : p(new int(v)) {}
+    Owner(const Owner& o) : p(new int(*o.p)) {}
+    Owner(Owner&& o) noexcept : p(o.p) { o.p = nullptr; moves++; }
+    Owner& operator=(const Owner& o) { *p = *o.p; return *this; }
+    Owner& operator=(Owner&& o) noexcept { std::swap(p, o.p); moves++; return *this; }
+    ~Owner() { delete p; }
+    auto operator<=>(const Owner& o) const { return *p <=> *o.p; }
+    bool operator==(const Owner& o) const { return *p == *o.p; }
+};
+
+template <>
+struct my_container::is_trivially_relocatable<Owner> : true_type {};
+
+TEST(VectorTest, trivially_relocatable_test) {
+    Vector<Owner> v;
+    for (int i = 0; i < 100; i++)
+        v.emplace_back(i);
+    v.shrink_to_fit();
+    Owner::moves = 0;
+    v.emplace(v.cbegin(), -1);
+    v.insert(v.cbegin() + 50, v[10]);
+    v.erase(v.cbegin() + 1);
+    v.erase(v.cbegin() + 10, v.cbegin() + 20);
+    ASSERT_EQ(Owner::moves, 0);
+    ASSERT_EQ(v.size(), 91);
+    ASSERT_EQ(*v[0].p, -1);
+    ASSERT_EQ(*v[1].p, 1);
+    ASSERT_EQ(*v[10].p, 20);
+    ASSERT_EQ(*v[39].p, 9);
+    ASSERT_EQ(*v.back().p, 99);
+
+    Vector<double> d{ 1.5, 2.5, 3.5 };
+    Vector<double> copy(d);
+    ASSERT_TRUE(copy == d);
+}
+
+TEST(VectorTest, iterator_concepts) {
+    static_assert(contiguous_iterator<Vector<int>::iterator>);
+    static_assert(contiguous_iterator<Vector<int>::const_iterator>);
+    static_assert(ranges::contiguous_range<Vector<string>>);
+    static_assert(ranges::contiguous_range<const Vector<string>>);
+    static_assert(is_convertible_v<Vector<int>::iterator, Vector<int>::const_iterator>);
+    static_assert(!is_convertible_v<Vector<int>::const_iterator, Vector<int>::iterator>);
+
+    Vector<Point> v;
+    v.emplace_back(1, "one");
+    auto it = v.begin();
+    ASSERT_EQ(it->name, "one");
+    it->x = 5;
+    const auto cit = v.cbegin();
+    ASSERT_EQ((*cit).x, 5);
+    ASSERT_EQ(cit[0].x, 5);
+    ASSERT_EQ(to_address(v.end()), v.data() + 1);
+}
+
+TEST(VectorTest, std_algorithms) {
+    Vector<int> v;
+    for (int i = 0; i < 1000; i++)
+        v.push_back((i * 7919) % 1000);
+    sort(v.begin(), v.end());
+    ASSERT_TRUE(is_sorted(v.cbegin(), v.cend()));
+    auto it = lower_bound(v.cbegin(), v.cend(), 500);
+    ASSERT_EQ(it - v.cbegin(), 500);
+    ASSERT_EQ(*it, 500);
+    reverse(v.begin(), v.end());
+    ASSERT_EQ(v.front(), 999);
+    ranges::sort(v);
+    ASSERT_EQ(v.front(), 0);
+
+    auto pos = v.begin();
+    pos += 10;
+    pos -= 3;
+    ASSERT_EQ(*pos, 7);
+    ASSERT_EQ(*(3 + pos), 10);
+    ASSERT_TRUE(v.begin() < pos && pos <= v.end() && pos > v.begin() && v.end() >= pos);
+
+    Vector<int> other;
+    other.insert(other.cend(), v.begin() + 10, v.begin() + 20);
+    ASSERT_EQ(other.size(), 10);
+    ASSERT_EQ(other.front(), 10);
+}
+
+TEST(VectorTest, parallel_algorithms) {
+    Vector<double> v;
+    for (int i = 0; i < 100000; i++)
+        v.push_back((i * 7919) % 100000);
+    sort(execution::par, v.begin(), v.end());
+    ASSERT_TRUE(is_sorted(v.begin(), v.end()));
+    for_each(execution::par, v.begin(), v.end(), [](double& x) { x *= 2; });
+    ASSERT_EQ(v[100], 200);
+    Vector<double> out(v.size(), 0);
+    transform(execution::par_unseq, v.cbegin(), v.cend(), out.begin(), [](double x) { return x + 1; });
+    ASSERT_EQ(out.back(), 2 * 99999 + 1);
+    ASSERT_EQ(reduce(execution::par, out.cbegin(), out.cend()), 99999.0 * 100000 + 100000);
+}
+
+template <class T>
+void check_simd_kernels() {
+    for (size_t n = 0; n < 70; n++) {
+        Vector<T> a(n, T(3));
+        ASSERT_EQ(a.count(T(3)), n);
+        ASSERT_TRUE(a.find(T(1)) == a.end());
+        Vector<T> b(a);
+        ASSERT_TRUE(a == b);
+        for (size_t i = 0; i < n; i++) {
+            b[i] = T(5);
+            ASSERT_EQ(simd::mismatch(a.data(), b.data(), n), i);
+            ASSERT_TRUE(a != b && a < b && b > a);
+            ASSERT_EQ(b.find(T(5)) - b.begin(), i);
+            ASSERT_EQ(b.count(T(5)), 1);
+            b[i] = T(3);
+        }
+        a.resize(n + 3, T(7));
+        ASSERT_EQ(a.count(T(7)), 3);
+        a.resize(n + 40);
+        ASSERT_EQ(a.count(T(0)), 37);
+        ASSERT_EQ(a.find(T(0)) - a.begin(), n + 3);
+    }
+}
+
+TEST(VectorTest, simd_kernels) {
+    for (simd::Isa isa : { simd::Isa::scalar, simd::Isa::sse2, simd::Isa::avx2 }) {
+        simd::limit_isa(isa);
+        check_simd_kernels<char>();
+        check_simd_kernels<short>();
+        check_simd_kernels<int>();
+        check_simd_kernels<unsigned>();
+        check_simd_kernels<long long>();
+        check_simd_kernels<float>();
+        check_simd_kernels<double>();
+    }
+    simd::limit_isa(simd::Isa::avx2);
+}
+
+TEST(VectorTest, simd_float_semantics) {
+    const float nan = numeric_limits<float>::quiet_NaN();
+    Vector<float> a(40, 1.0f), b(40, 1.0f);
+    a[33] = -0.0f;
+    b[33] = 0.0f;
+    ASSERT_TRUE(a == b);
+    a[20] = nan;
+    b[20] = nan;
+    ASSERT_FALSE(a == b);
+    ASSERT_EQ(a <=> b, partial_ordering::unordered);
+    ASSERT_TRUE(a.find(nan) == a.end());
+    ASSERT_EQ(a.count(0.0f), 1);
+
+    Vector<long long> c(9, -1), d(9, -1);
+    d[4] = 0xFFFFFFFFLL;
+    ASSERT_EQ(simd::mismatch(c.data(), d.data(), c.size()), 4);
+    ASSERT_TRUE(d > c);
+}
+
+struct Feature {
+    int id;
+    float weight;
+    long long stamp;
+    bool operator==(const Feature&) const = default;
+};
+
+TEST(MappedVectorTest, persist_and_reopen) {
+    string path = testing::TempDir() + "mapped_vector_persist.bin";
+    remove(path.c_str());
+    {
+        MappedVector<Feature> v(path);
+        ASSERT_TRUE(v.empty());
+        for (int i = 0; i < 10000; i++)
+            v.push_back(Feature{ i, i * 0.5f, (long long)i * 3 });
+        v.emplace_back(Feature{ -1, 0, 0 });
+        v.pop_back();
+        ASSERT_EQ(v.size(), 10000);
+        ASSERT_TRUE(v.capacity() >= 10000);
+        v.sync();
+    }
+    {
+        MappedVector<Feature> v(path);
+        ASSERT_EQ(v.size(), 10000);
+        ASSERT_EQ(v[1234].id, 1234);
+        ASSERT_EQ(v.back().stamp, 9999 * 3);
+        long long sum = 0;
+        for (const Feature& f : v)
+            sum += f.id;
+        ASSERT_EQ(sum, 9999LL * 10000 / 2);
+        v.resize(5);
+        v.shrink_to_fit();
+        ASSERT_EQ(v.capacity(), 5);
+        ASSERT_THROW(v.at(5), out_of_range);
+    }
+    MappedVector<Feature> v(path);
+    ASSERT_EQ(v.size(), 5);
+    ASSERT_EQ(v.capacity(), 5);
+    remove(path.c_str());
+}
+
+TEST(MappedVectorTest, append_and_move) {
+    string path = testing::TempDir() + "mapped_vector_append.bin";
+    remove(path.c_str());
+    MappedVector<int> v(path);
+    Vector<int> src{ 1, 2, 3 };
+    v.append_range(src);
+    v.append_range(std::vector<int>(1000, 7));
+    istringstream in("8 9");
+    v.append_range(ranges::subrange(istream_iterator<int>(in), istream_iterator<int>()));
+    ASSERT_EQ(v.size(), 1005);
+    ASSERT_EQ(v[2], 3);
+    ASSERT_EQ(v.back(), 9);
+    v.resize(1010, 4);
+    ASSERT_EQ(v[1009], 4);
+
+    MappedVector<int> moved(move(v));
+    ASSERT_EQ(moved.size(), 1010);
+    ASSERT_EQ(moved[0], 1);
+    v = move(moved);
+    ASSERT_EQ(v.size(), 1010);
+    v.clear();
+    ASSERT_TRUE(v.empty());
+    remove(path.c_str());
+}
+
+TEST(MappedVectorTest, append_self) {
+    string path = testing::TempDir() + "mapped_vector_self.bin";
+    remove(path.c_str());
+    MappedVector<int> v(path);
+    for (int i = 0; i < 1000; i++)
+        v.push_back(i);
+    // Без запаса ёмкости append_range и emplace_back расширяют файл, и
+    // отображение может переехать вместе с исходными данными.
+    v.shrink_to_fit();
+    v.append_range(v);
+    ASSERT_EQ(v.size(), 2000);
+    for (int i = 0; i < 2000; i++)
+        ASSERT_EQ(v[i], i % 1000);
+    v.shrink_to_fit();
+    v.append_range(span<const int>(v.data() + 10, 5));
+    ASSERT_EQ(v.size(), 2005);
+    ASSERT_EQ(v.back(), 14);
+    v.shrink_to_fit();
+    v.emplace_back(v[0]);
+    ASSERT_EQ(v.back(), 0);
+    v.shrink_to_fit();
+    v.push_back(v[1]);
+    ASSERT_EQ(v.back(), 1);
+    remove(path.c_str());
+}
+
+TEST(MappedVectorTest, reject_foreign_file) {
+    string path = testing::TempDir() + "mapped_vector_foreign.bin";
+    remove(path.c_str());
+    {
+        MappedVector<int> v(path);
+        v.push_back(1);
+    }
+    ASSERT_THROW(MappedVector<double>{ path }, runtime_error);
+    {
+        FILE* f = fopen(path.c_str(), "wb");
+        fputs("definitely not a vector, but long enough to hold a header.........", f);
+        fclose(f);
+    }
+    ASSERT_THROW(MappedVector<char>{ path }, runtime_error);
+    remove(path.c_str());
+    ASSERT_THROW(MappedVector<int>{ "/nonexistent/dir/file.bin" }, system_error);
+}
+
+// Элемент, бросающий на countdown-м копировании или перемещении.
+struct Flaky {
+    static inline int countdown = -1;
+    static inline int copies = 0;
+    static inline int compares = 0;
+    static inline int alive = 0;
+    int val;
+    Flaky(int val) : val(val) { alive++; }
+    Flaky(const Flaky& f) : val(f.val) {
+        tick();
+        copies++;
+        alive++;
+    }
+    Flaky(Flaky&& f) : val(f.val) {
+        tick();
+        alive++;
+    }
+    Flaky& operator=(const Flaky& f) {
+        tick();
+        copies++;
+        val = f.val;
+        return *this;
+    }
+    ~Flaky() { alive--; }
+    auto operator<=>(const Flaky& f) const {
+        compares++;
+        return val <=> f.val;
+    }
+    bool operator==(const Flaky& f) const { return val == f.val; }
+    static void tick() {
+        if (countdown == 0)
+            throw runtime_error("injected");
+        if (countdown > 0)
+            countdown--;
+    }
+};
+
+// Повторяет op, бросая на 0-й, 1-й, ... операции с элементом, пока op не
+// пройдёт; после каждого исключения вектор должен остаться прежним.
+template <class Op>
+void check_strong(const Vector<Flaky>& origin, Op op) {
+    for (int k = 0;; k++) {
+        Vector<Flaky> v(origin);
+        v.reserve(origin.capacity());
+        const Flaky* data = v.data();
+        size_t capacity = v.capacity();
+        int alive = Flaky::alive;
+        Flaky::countdown = k;
+        try {
+            op(v);
+            Flaky::countdown = -1;
+            return;
+        }
+        catch (const runtime_error&) {
+            Flaky::countdown = -1;
+        }
+        ASSERT_EQ(Flaky::alive, alive);
+        ASSERT_EQ(v.data(), data);
+        ASSERT_EQ(v.capacity(), capacity);
+        ASSERT_EQ(v.size(), origin.size());
+        for (size_t i = 0; i < v.size(); i++)
+            ASSERT_EQ(v[i].val, origin[i].val);
+    }
+}
+
+TEST(VectorTest, strong_exception_safety) {
+    Vector<Flaky> full;
+    for (int i = 0; i < 6; i++)
+        full.emplace_back(i);
+    full.shrink_to_fit();
+    const Vector<Flaky> other{ 10, 11, 12, 13, 14, 15, 16, 17, 18 };
+
+    check_strong(full, [](Vector<Flaky>& v) { v.push_back(v[2]); });
+    check_strong(full, [](Vector<Flaky>& v) { v.emplace_back(42); });
+    check_strong(full, [](Vector<Flaky>& v) { v.insert(v.cbegin() + 1, v[4]); });
+    check_strong(full, [&](Vector<Flaky>& v) { v.insert(v.cbegin() + 3, other.begin(), other.end()); });
+    check_strong(full, [](Vector<Flaky>& v) { v.insert(v.cbegin(), 4, Flaky(7)); });
+    check_strong(full, [](Vector<Flaky>& v) { v.reserve(50); });
+    check_strong(full, [](Vector<Flaky>& v) { v.resize(20, v[0]); });
+    Vector<Flaky> part{ 0, 1, 2 };
+    part.reserve(6);
+    check_strong(part, [](Vector<Flaky>& v) { v.resize(5, v[1]); });
+    check_strong(full, [&](Vector<Flaky>& v) { v = other; });
+    check_strong(other, [&](Vector<Flaky>& v) { v = full; });
+    check_strong(full, [](Vector<Flaky>& v) { Vector<Flaky> copy(v); });
+    ASSERT_EQ(Flaky::alive, int(full.size() + other.size() + part.size()));
+}
+
+TEST(VectorTest, assignment_copies_once) {
+    Vector<Flaky> a{ 1, 2, 3, 4, 5 };
+    Vector<Flaky> b{ 1, 2, 3 };
+    Vector<Flaky> c{ 9 };
+    Flaky::copies = 0;
+    Flaky::compares = 0;
+    b = a;
+    ASSERT_EQ(Flaky::copies, 5);
+    b = b;
+    c = a;
+    ASSERT_EQ(Flaky::copies, 10);
+    ASSERT_EQ(Flaky::compares, 0);
+    ASSERT_TRUE(a == b && b == c);
+
+    Vector<CopyCounter> d{ 1, 2, 3, 4 };
+    Vector<CopyCounter> e{ 7, 7, 7, 7, 7, 7 };
+    CopyCounter::copies = 0;
+    e = d;
+    ASSERT_EQ(CopyCounter::copies, 4);
+    Vector<int> f{ 1, 2 };
+    Vector<int> g{ 7, 8, 9 };
+    const int* storage = g.data();
+    g = f;
+    ASSERT_EQ(g.data(), storage);
+    CopyCounter::copies = 0;
+    d.resize(40, d[0]);
+    ASSERT_EQ(CopyCounter::copies, 36);
+}
+
+TEST(SmallVectorTest, no_heap_below_n) {
+    size_t before = heap_allocations;
+    {
+        SmallVector<int, 8> v;
+        for (int i = 0; i < 8; i++)
+            v.push_back(i);
+        v.erase(v.cbegin());
+        v.insert(v.cbegin(), 0);
+        SmallVector<int, 8> copy(v);
+        SmallVector<int, 8> moved(move(copy));
+        moved.swap(v);
+        v = moved;
+        ASSERT_EQ(v.capacity(), 8);
+        ASSERT_TRUE(v == moved);
+        for (int i = 0; i < 8; i++)
+            ASSERT_EQ(v[i], i);
+    }
+    {
+        SmallVector<string, 4> s{ "a", "b", "c" };
+        s.emplace_back("d");
+        s.pop_back();
+        s.shrink_to_fit();
+        ASSERT_EQ(s.capacity(), 4);
+        SmallVector<string, 4> t{ "x" };
+        t = s;
+        ASSERT_EQ(t.capacity(), 4);
+        ASSERT_TRUE(t == s);
+        SmallVector<string, 4> u{ "p", "q", "r", "s" };
+        u = t;
+        ASSERT_EQ(u.size(), 3);
+        ASSERT_EQ(u[2], "c");
+    }
+    ASSERT_EQ(heap_allocations, before);
+}
+
+TEST(SmallVectorTest, spill_to_heap) {
+    SmallVector<string, 2> v{ "a", "b" };
+    size_t before = heap_allocations;
+    v.push_back("c");
+    ASSERT_EQ(heap_allocations, before + 1);
+    ASSERT_TRUE(v.capacity() > 2);
+    ASSERT_TRUE(v == Vector<string>({ "a", "b", "c" }));
+    v.pop_back();
+    v.shrink_to_fit();
+    ASSERT_EQ(v.capacity(), 2);
+    ASSERT_TRUE(v == Vector<string>({ "a", "b" }));
+    v.append_range(Vector<string>({ "x", "y", "z" }));
+
+    Vector<string> plain(move(v));
+    ASSERT_EQ(plain.size(), 5);
+    ASSERT_TRUE(v.empty());
+    ASSERT_EQ(v.capacity(), 2);
+    v.push_back("again");
+    ASSERT_EQ(v[0], "again");
+}
+
+TEST(SmallVectorTest, container_interface) {
+    SmallVector<int, 4> a{ 1, 2, 3 };
+    Vector<int> b{ 1, 2, 3 };
+    const Container<int>& ca = a;
+    ASSERT_TRUE(ca == b);
+    ASSERT_EQ(ca.size(), 3);
+    Vector<int>& va = a;
+    va.insert(va.cbegin(), { 7, 8, 9, 10, 11 });
+    ASSERT_EQ(a.size(), 8);
+    ASSERT_EQ(a.front(), 7);
+
+    SmallVector<int, 4> small{ 5 };
+    a.swap(small);
+    ASSERT_EQ(a.size(), 1);
+    ASSERT_EQ(small.size(), 8);
+    ASSERT_EQ(small.back(), 3);
+    b.swap(a);
+    ASSERT_EQ(a.size(), 3);
+    ASSERT_EQ(b.front(), 5);
+
+    int sum = 0;
+    for (auto it = small.begin(); it != small.end(); ++it)
+        sum += *it;
+    ASSERT_EQ(sum, 51);
+}
+
+TEST(ArenaTest, bump_and_reset) {
+    Arena arena(256);
+    void* a = arena.allocate(10, 1);
+    void* b = arena.allocate(8, 8);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(b) % 8, 0);
+    ASSERT_TRUE(static_cast<char*>(b) >= static_cast<char*>(a) + 10);
+    arena.deallocate(b, 8);
+    ASSERT_EQ(arena.allocate(8, 8), b);
+    arena.allocate(1000, 16);
+    ASSERT_EQ(arena.blocks(), 2);
+    arena.reset();
+    ASSERT_EQ(arena.blocks(), 1);
+    size_t before = heap_allocations;
+    for (int i = 0; i < 40; i++)
+        arena.allocate(16, 16);
+    arena.reset();
+    ASSERT_EQ(heap_allocations, before);
+}
+
+TEST(ArenaTest, vectors_in_arena) {
+    Arena arena;
+    arena.allocate(1, 1);
+    size_t before = heap_allocations;
+    {
+        Vector<int, ArenaAllocator<int>> a(arena);
+        for (int i = 0; i < 1000; i++)
+            a.push_back(i);
+        Vector<string, ArenaAllocator<string>> s({ "a", "b", "c" }, arena);
+        s.insert(s.cbegin(), 2, "x");
+        Vector<int, ArenaAllocator<int>> copy(a);
+        ASSERT_TRUE(copy == a);
+        ASSERT_TRUE(copy.get_allocator() == a.get_allocator());
+        Vector<int, ArenaAllocator<int>> moved(move(copy));
+        ASSERT_TRUE(copy.empty());
+        ASSERT_EQ(moved[999], 999);
+        ASSERT_EQ(s.size(), 5);
+        ASSERT_EQ(s[1], "x");
+    }
+    arena.reset();
+    ASSERT_EQ(heap_allocations, before);
+}
+
+TEST(ArenaTest, different_arenas) {
+    Arena first, second;
+    Vector<string, ArenaAllocator<string>> a({ "a", "b" }, first);
+    Vector<string, ArenaAllocator<string>> b({ "c", "d", "e" }, second);
+    Vector<string, ArenaAllocator<string>> c(move(b), first);
+    ASSERT_EQ(c.size(), 3);
+    ASSERT_TRUE(&c.get_allocator().arena() == &first);
+    a = c;
+    ASSERT_TRUE(a == c);
+    a = move(b);
+    ASSERT_TRUE(&a.get_allocator().arena() == &second);
+    ASSERT_TRUE(a.empty());
+    a.push_back("z");
+    c.swap(a);
+    ASSERT_TRUE(&c.get_allocator().arena() == &second);
+    ASSERT_EQ(c[0], "z");
+    ASSERT_EQ(a.size(), 3);
+}
+
+TEST(PoolTest, reuse_blocks) {
+    Pool pool;
+    void* a = pool.allocate(24, 8);
+    pool.deallocate(a, 24, 8);
+    ASSERT_EQ(pool.allocate(32, 8), a);
+    void* big = pool.allocate(5000, 8);
+    pool.deallocate(big, 5000, 8);
+    pool.deallocate(a, 32, 8);
+
+    Vector<int, PoolAllocator<int>> v(pool);
+    for (int i = 0; i < 200; i++)
+        v.push_back(i);
+    size_t before = heap_allocations;
+    for (int round = 0; round < 10; round++) {
+        Vector<int, PoolAllocator<int>> tmp(v);
+        tmp.push_back(round);
+        ASSERT_EQ(tmp.back(), round);
+    }
+    ASSERT_EQ(heap_allocations, before);
+    SmallVector<int, 4, PoolAllocator<int>> s({ 1, 2, 3, 4, 5 }, pool);
+    ASSERT_EQ(s.size(), 5);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();